@@ -0,0 +1,93 @@
+/**
+ * @file parallel_max_flow_benchmark.cpp
+ * @brief Масштабирование ParallelPushRelabelSolver по числу потоков.
+ *
+ * Строит случайную слоистую сеть и решает её последовательным
+ * PushRelabelSolver и параллельным решателем с 1, 2, 4, ... потоками,
+ * печатая время и ускорение относительно одного потока.
+ *
+ * Запуск: parallel_max_flow_benchmark [слоёв] [ширина слоя] [степень]
+ */
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+#include "../include/algorithms/flowNetwork/ParallelPushRelabel.h"
+#include "../include/algorithms/flowNetwork/PushRelabel.h"
+#include "../include/graph/DirectedGraph.h"
+
+namespace {
+
+using Network = graph::FlowNetwork<graph::DirectedGraph<>>;
+
+Network makeLayeredNetwork(int layers, int width, int degree) {
+  std::mt19937 rng(2024);
+  Network network;
+  int source = layers * width;
+  int sink = source + 1;
+  for (int i = 0; i < width; ++i) {
+    network.addEdge(graph::Vertex(source), graph::Vertex(i), 1000);
+    network.addEdge(graph::Vertex((layers - 1) * width + i),
+                    graph::Vertex(sink), 1000);
+  }
+  for (int layer = 0; layer + 1 < layers; ++layer) {
+    for (int i = 0; i < width; ++i) {
+      for (int k = 0; k < degree; ++k) {
+        int j = static_cast<int>(rng() % width);
+        network.addEdge(graph::Vertex(layer * width + i),
+                        graph::Vertex((layer + 1) * width + j),
+                        1 + static_cast<int>(rng() % 100));
+      }
+    }
+  }
+  network.buildArcIndex();
+  return network;
+}
+
+template <typename Solve>
+double measure(Solve&& solve) {
+  auto start = std::chrono::steady_clock::now();
+  solve();
+  auto finish = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(finish - start).count();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int layers = argc > 1 ? std::atoi(argv[1]) : 200;
+  int width = argc > 2 ? std::atoi(argv[2]) : 2000;
+  int degree = argc > 3 ? std::atoi(argv[3]) : 4;
+
+  const Network base = makeLayeredNetwork(layers, width, degree);
+  graph::Vertex source(layers * width);
+  graph::Vertex sink(layers * width + 1);
+  std::cout << "vertices: " << base.vertexCount()
+            << ", arcs: " << base.edgeCount() << "\n";
+
+  Network sequentialNetwork = base;
+  graph::PushRelabelSolver<graph::DirectedGraph<>> sequential(
+      sequentialNetwork);
+  int expected = 0;
+  double sequentialTime =
+      measure([&] { expected = sequential.computeMaxFlow(source, sink); });
+  std::cout << "sequential: flow " << expected << ", " << sequentialTime
+            << " ms\n";
+
+  double singleThread = 0;
+  for (size_t threads = 1; threads <= graph::defaultThreadCount();
+       threads *= 2) {
+    Network network = base;
+    graph::ParallelPushRelabelSolver<graph::DirectedGraph<>> solver(network,
+                                                                    threads);
+    int flow = 0;
+    double time = measure([&] { flow = solver.computeMaxFlow(source, sink); });
+    if (threads == 1) singleThread = time;
+    std::cout << "threads " << threads << ": flow " << flow << ", " << time
+              << " ms, speedup " << singleThread / time
+              << (flow == expected ? "" : "  MISMATCH") << "\n";
+    if (flow != expected) return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,236 @@
+#ifndef ADJACENCY_VIEW_H
+#define ADJACENCY_VIEW_H
+
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Graph.h"
+
+namespace graph {
+
+/**
+ * @class AdjacencyView
+ * @brief Представление графа в формате CSR для обходов.
+ *
+ * Вершины нумеруются плотными индексами в порядке getVertices(), исходящие
+ * рёбра хранятся одним массивом индексов концов со смещениями по вершинам.
+ * Позиция ребра в этом массиве служит его номером. Неориентированные графы
+ * хранят каждое ребро в обоих направлениях, поэтому их представление
+ * симметрично.
+ *
+ * @tparam VertexType Тип вершины.
+ */
+template <typename VertexType = Vertex>
+class AdjacencyView {
+ public:
+  /**
+   * @brief Строит представление по списку рёбер между индексами вершин.
+   *
+   * @param vertices Вершины в порядке индексов.
+   * @param edges Рёбра: пары (индекс начала, индекс конца).
+   * @throws std::out_of_range Если индекс ребра выходит за пределы вершин.
+   */
+  AdjacencyView(std::vector<VertexType> vertices,
+                const std::vector<std::pair<uint32_t, uint32_t>>& edges)
+      : vertices(std::move(vertices)) {
+    for (size_t v = 0; v < this->vertices.size(); ++v) {
+      vertexToIndex.emplace(this->vertices[v], v);
+    }
+    for (const auto& [u, v] : edges) {
+      if (u >= this->vertices.size() || v >= this->vertices.size()) {
+        throw std::out_of_range("Vertex not found");
+      }
+    }
+    build(edges);
+  }
+
+  /**
+   * @brief Строит представление графа.
+   *
+   * Рёбра, концы которых отсутствуют среди вершин графа, пропускаются.
+   *
+   * @param graph Граф.
+   */
+  template <typename EdgeType>
+  explicit AdjacencyView(const Graph<VertexType, EdgeType>& graph) {
+    const auto& graphVertices = graph.getVertices();
+    vertices.assign(graphVertices.begin(), graphVertices.end());
+    for (size_t v = 0; v < vertices.size(); ++v) {
+      vertexToIndex.emplace(vertices[v], v);
+    }
+    std::vector<std::pair<uint32_t, uint32_t>> edges;
+    edges.reserve(graph.getEdges().size());
+    for (const auto& e : graph.getEdges()) {
+      auto source = vertexToIndex.find(e.source);
+      auto target = vertexToIndex.find(e.target);
+      if (source == vertexToIndex.end() || target == vertexToIndex.end()) {
+        continue;
+      }
+      edges.emplace_back(static_cast<uint32_t>(source->second),
+                         static_cast<uint32_t>(target->second));
+    }
+    build(edges);
+  }
+
+  /**
+   * @brief Возвращает число вершин.
+   */
+  size_t vertexCount() const { return vertices.size(); }
+
+  /**
+   * @brief Возвращает число рёбер.
+   */
+  size_t edgeCount() const { return adjacency.size(); }
+
+  /**
+   * @brief Возвращает вершину по индексу.
+   */
+  const VertexType& getVertex(size_t v) const { return vertices[v]; }
+
+  /**
+   * @brief Возвращает индекс вершины.
+   * @throws std::out_of_range Если вершины нет в графе.
+   */
+  size_t getIndex(const VertexType& v) const {
+    auto it = vertexToIndex.find(v);
+    if (it == vertexToIndex.end()) {
+      throw std::out_of_range("Vertex not found");
+    }
+    return it->second;
+  }
+
+  /**
+   * @brief Возвращает начало исходящих рёбер вершины в массиве смежности.
+   */
+  size_t begin(size_t u) const { return offsets[u]; }
+
+  /**
+   * @brief Возвращает конец исходящих рёбер вершины в массиве смежности.
+   */
+  size_t end(size_t u) const { return offsets[u + 1]; }
+
+  /**
+   * @brief Возвращает число исходящих рёбер вершины.
+   */
+  size_t degree(size_t u) const { return offsets[u + 1] - offsets[u]; }
+
+  /**
+   * @brief Возвращает конец ребра по позиции в массиве смежности.
+   */
+  uint32_t neighbor(size_t position) const { return adjacency[position]; }
+
+  /**
+   * @brief Раскладывает значения рёбер графа по позициям массива смежности.
+   *
+   * Граф должен быть тем же, по которому построено представление: рёбра
+   * обходятся в том же порядке, что и при построении, и попадают на те же
+   * позиции.
+   *
+   * @param graph Граф представления.
+   * @param value Функция value(edge), возвращающая значение ребра.
+   * @return Значения рёбер по позициям.
+   */
+  template <typename EdgeType, typename Function>
+  auto edgeValues(const Graph<VertexType, EdgeType>& graph,
+                  Function&& value) const {
+    using Value = std::decay_t<decltype(value(std::declval<EdgeType>()))>;
+    std::vector<Value> result(adjacency.size());
+    std::vector<size_t> cursor(offsets.begin(), offsets.end() - 1);
+    for (const auto& e : graph.getEdges()) {
+      auto source = vertexToIndex.find(e.source);
+      auto target = vertexToIndex.find(e.target);
+      if (source == vertexToIndex.end() || target == vertexToIndex.end()) {
+        continue;
+      }
+      result[cursor[source->second]++] = value(e);
+    }
+    return result;
+  }
+
+  /**
+   * @brief Строит представление того же графа с обращёнными рёбрами.
+   */
+  AdjacencyView transpose() const {
+    AdjacencyView result;
+    result.vertices = vertices;
+    result.vertexToIndex = vertexToIndex;
+    const size_t n = vertices.size();
+    result.offsets.assign(n + 1, 0);
+    for (uint32_t v : adjacency) {
+      ++result.offsets[v + 1];
+    }
+    for (size_t v = 0; v < n; ++v) {
+      result.offsets[v + 1] += result.offsets[v];
+    }
+    result.adjacency.resize(adjacency.size());
+    std::vector<size_t> cursor(result.offsets.begin(),
+                               result.offsets.end() - 1);
+    for (size_t u = 0; u < n; ++u) {
+      for (size_t i = offsets[u]; i < offsets[u + 1]; ++i) {
+        result.adjacency[cursor[adjacency[i]]++] = static_cast<uint32_t>(u);
+      }
+    }
+    return result;
+  }
+
+  /**
+   * @brief Строит симметричное представление того же графа.
+   *
+   * Каждое ребро записывается в обоих направлениях; нужно для алгоритмов,
+   * ожидающих неориентированный граф, когда рёбра хранятся в одну сторону
+   * (например, в AdjacencyListGraph).
+   */
+  AdjacencyView symmetrize() const {
+    std::vector<std::pair<uint32_t, uint32_t>> edges;
+    edges.reserve(2 * adjacency.size());
+    for (size_t u = 0; u < vertices.size(); ++u) {
+      for (size_t i = offsets[u]; i < offsets[u + 1]; ++i) {
+        edges.emplace_back(static_cast<uint32_t>(u), adjacency[i]);
+        edges.emplace_back(adjacency[i], static_cast<uint32_t>(u));
+      }
+    }
+    AdjacencyView result;
+    result.vertices = vertices;
+    result.vertexToIndex = vertexToIndex;
+    result.build(edges);
+    return result;
+  }
+
+ private:
+  std::vector<VertexType> vertices;  ///< Вершины по индексам.
+  std::unordered_map<VertexType, size_t> vertexToIndex;  ///< Индексы вершин.
+  std::vector<size_t> offsets;      ///< Начало рёбер каждой вершины.
+  std::vector<uint32_t> adjacency;  ///< Индексы концов рёбер.
+
+  /**
+   * @brief Пустое представление для transpose() и symmetrize().
+   */
+  AdjacencyView() = default;
+
+  /**
+   * @brief Раскладывает рёбра по вершинам подсчётом.
+   */
+  void build(const std::vector<std::pair<uint32_t, uint32_t>>& edges) {
+    const size_t n = vertices.size();
+    offsets.assign(n + 1, 0);
+    for (const auto& [u, v] : edges) {
+      ++offsets[u + 1];
+    }
+    for (size_t u = 0; u < n; ++u) {
+      offsets[u + 1] += offsets[u];
+    }
+    adjacency.resize(edges.size());
+    std::vector<size_t> cursor(offsets.begin(), offsets.end() - 1);
+    for (const auto& [u, v] : edges) {
+      adjacency[cursor[u]++] = v;
+    }
+  }
+};
+
+}  // namespace graph
+
+#endif  // ADJACENCY_VIEW_H
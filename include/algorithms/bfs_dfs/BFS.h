@@ -3,6 +3,7 @@
 
 #include <iostream>
 #include <queue>
+#include <type_traits>
 #include <unordered_set>
 
 #include "Graph.h"
@@ -12,55 +13,83 @@ namespace graph {
 
 /**
  * @brief Реализация алгоритма поиска в ширину (BFS).
+ *
+ * Методы посетителя вызываются статически, так что пустые обработчики
+ * (NullVisitor) ничего не стоят. Наследники виртуального Visitor
+ * оборачиваются в VisitorAdapter.
+ *
+ * Методы посетителя могут вернуть VisitorAction: Stop завершает обход сразу
+ * (расстояния недостигнутых вершин остаются нулевыми), SkipChildren в
+ * visitVertex не раскрывает вершину, в examineEdge не проходит по ребру, а в
+ * treeEdge оставляет достигнутую вершину без раскрытия.
+ *
  * @tparam VertexType Тип вершины.
  * @tparam EdgeType Тип ребра.
+ * @tparam VisitorType Тип посетителя.
  * @param graph Граф, по которому выполняется поиск.
  * @param startVertex Начальная вершина для поиска.
- * @param visitor Посетитель (Visitor), который обрабатывает события BFS.
+ * @param visitor Посетитель, который обрабатывает события BFS.
  * @return Вектор расстояний от начальной вершины до всех остальных вершин.
  */
-template <typename VertexType, typename EdgeType>
+template <typename VertexType, typename EdgeType, typename VisitorType>
 std::vector<int> BFS(Graph<VertexType, EdgeType>& graph,
-                     const Vertex& startVertex,
-                     Visitor<VertexType, EdgeType>& visitor) {
-  std::queue<VertexType> queue;  // Очередь для BFS.
-  std::unordered_set<VertexType> visited;  // Множество посещённых вершин.
-  std::vector<int> d(graph.getVertices().size() + 1, 0);  // Вектор расстояний.
+                     const Vertex& startVertex, VisitorType& visitor) {
+  if constexpr (std::is_base_of_v<Visitor<VertexType, EdgeType>,
+                                  VisitorType>) {
+    VisitorAdapter<VertexType, EdgeType> adapter(visitor);
+    return BFS(graph, startVertex, adapter);
+  } else {
+    std::queue<VertexType> queue;  // Очередь для BFS.
+    std::unordered_set<VertexType> visited;  // Множество посещённых вершин.
+    // Вектор расстояний.
+    std::vector<int> d(graph.getVertices().size() + 1, 0);
 
-  // Начинаем с начальной вершины.
-  queue.push(startVertex);
-  visited.insert(startVertex);
+    // Начинаем с начальной вершины.
+    queue.push(startVertex);
+    visited.insert(startVertex);
 
-  while (!queue.empty()) {
-    VertexType currentVertex = queue.front();
-    queue.pop();
+    while (!queue.empty()) {
+      VertexType currentVertex = queue.front();
+      queue.pop();
 
-    // Обрабатываем текущую вершину.
-    visitor.visitVertex(currentVertex);
+      // Обрабатываем текущую вершину.
+      VisitorAction action =
+          visitorAction([&] { return visitor.visitVertex(currentVertex); });
+      if (action == VisitorAction::Stop) return d;
 
-    // Получаем соседей текущей вершины.
-    auto neighbors = graph.getAdjacencyVertices(currentVertex);
-    for (auto& vertex : neighbors) {
-      // Исследуем ребро между текущей вершиной и соседом.
-      visitor.examineEdge(EdgeType(currentVertex, vertex));
+      if (action != VisitorAction::SkipChildren) {
+        // Получаем соседей текущей вершины.
+        auto neighbors = graph.getAdjacencyVertices(currentVertex);
+        for (auto& vertex : neighbors) {
+          // Исследуем ребро между текущей вершиной и соседом.
+          action = visitorAction(
+              [&] { return visitor.examineEdge(currentVertex, vertex); });
+          if (action == VisitorAction::Stop) return d;
+          if (action == VisitorAction::SkipChildren) continue;
 
-      // Если соседняя вершина ещё не посещена, добавляем её в очередь.
-      if (visited.find(vertex) == visited.end()) {
-        visited.insert(vertex);
-        queue.push(vertex);
-        d[vertex.id] = d[currentVertex.id] + 1;  // Обновляем расстояние.
+          // Если соседняя вершина ещё не посещена, добавляем её в очередь.
+          if (visited.find(vertex) == visited.end()) {
+            visited.insert(vertex);
+            d[vertex.id] = d[currentVertex.id] + 1;  // Обновляем расстояние.
 
-        // Обрабатываем ребро, добавленное в дерево поиска.
-        visitor.treeEdge(EdgeType(currentVertex, vertex));
+            // Обрабатываем ребро, добавленное в дерево поиска.
+            action = visitorAction(
+                [&] { return visitor.treeEdge(currentVertex, vertex); });
+            if (action == VisitorAction::Stop) return d;
+            if (action != VisitorAction::SkipChildren) queue.push(vertex);
+          }
+        }
       }
+
+      // Завершаем обработку текущей вершины.
+      action =
+          visitorAction([&] { return visitor.finishVertex(currentVertex); });
+      if (action == VisitorAction::Stop) return d;
     }
 
-    // Завершаем обработку текущей вершины.
-    visitor.finishVertex(currentVertex);
+    // Возвращаем вектор расстояний.
+    return d;
   }
-
-  // Возвращаем вектор расстояний.
-  return d;
 }
 
 }  // namespace graph
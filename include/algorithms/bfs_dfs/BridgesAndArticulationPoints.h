@@ -1,15 +1,33 @@
 #ifndef BRIDGES_AND_ARTICULATION_POINTS_H
 #define BRIDGES_AND_ARTICULATION_POINTS_H
 
-#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+#include <utility>
 #include <vector>
 
+#include "AdjacencyView.h"
 #include "Graph.h"
 
 namespace graph {
 
 /**
  * @brief Класс для поиска мостов и точек сочленения в графе.
+ *
+ * Граф рассматривается как неориентированный: каждое ребро должно быть
+ * записано в обоих направлениях (так хранит рёбра UndirectedGraph). Мосты и
+ * точки сочленения находятся одним проходом итеративного поиска в глубину
+ * по AdjacencyView: времена входа и low-значения лежат в плотных массивах,
+ * вместо рекурсии — явный стек, поэтому длинные пути не переполняют стек
+ * вызовов. Ребро к родителю пропускается один раз, так что кратные рёбра
+ * мостами не считаются.
+ *
+ * Тот же проход разбивает рёбра на блоки — компоненты двусвязности. Вместо
+ * стека рёбер используется стек вершин: каждое ребро лежит в одном блоке с
+ * древесным ребром, ведущим в его более глубокий конец, поэтому достаточно
+ * запомнить блок древесного ребра каждой вершины. Петли и изолированные
+ * вершины блоков не образуют.
+ *
  * @tparam VertexType Тип вершины.
  * @tparam EdgeType Тип ребра.
  */
@@ -18,133 +36,218 @@ class BridgesAndArticulationPoints {
  public:
   /**
    * @brief Конструктор класса.
-   * @param graph Граф, в котором ищутся мосты и точки сочленения.
+   * @param graph Граф, в котором ищутся мосты и точки сочленения; не
+   * копируется.
    */
-  BridgesAndArticulationPoints(Graph<VertexType, EdgeType> graph)
-      : graph(graph), time(0) {}
+  explicit BridgesAndArticulationPoints(
+      const Graph<VertexType, EdgeType>& graph)
+      : BridgesAndArticulationPoints(AdjacencyView<VertexType>(graph)) {}
+
+  /**
+   * @brief Конструктор по готовому представлению графа.
+   * @param view Симметричное представление графа.
+   */
+  explicit BridgesAndArticulationPoints(AdjacencyView<VertexType> view)
+      : view(std::move(view)) {
+    search();
+  }
 
   /**
    * @brief Поиск всех мостов в графе.
-   * @return Вектор рёбер, являющихся мостами.
+   * @return Вектор рёбер, являющихся мостами; ребро направлено от вершины,
+   * найденной поиском раньше.
    */
-  std::vector<EdgeType> findBridges() {
-    std::vector<EdgeType> bridges;  // Вектор для хранения мостов.
-    std::unordered_map<int, int> discoveryTime;  // Время обнаружения вершин.
-    std::unordered_map<int, int> low;  // Минимальное время достижимости.
-    std::unordered_map<int, int> parent;  // Родительские вершины.
-
-    // Обход всех вершин графа.
-    for (const auto& vertex : graph.getVertices()) {
-      if (discoveryTime.find(vertex.id) == discoveryTime.end()) {
-        dfsBridges(vertex, discoveryTime, low, parent, bridges);
-      }
+  std::vector<EdgeType> findBridges() const {
+    std::vector<EdgeType> result;
+    result.reserve(bridges.size());
+    for (const auto& [u, v] : bridges) {
+      result.push_back(EdgeType(view.getVertex(u), view.getVertex(v)));
     }
-
-    return bridges;
+    return result;
   }
 
   /**
    * @brief Поиск всех точек сочленения в графе.
-   * @return Вектор идентификаторов вершин, являющихся точками сочленения.
+   * @return Вектор идентификаторов вершин, являющихся точками сочленения;
+   * каждая вершина встречается один раз.
    */
-  std::vector<int> findArticulationPoints() {
-    std::vector<int> articulationPoints;
-    std::unordered_map<int, int> discoveryTime;
-    std::unordered_map<int, int> low;
-    std::unordered_map<int, int> parent;
-
-    // Обход всех вершин графа.
-    for (const auto& vertex : graph.getVertices()) {
-      if (discoveryTime.find(vertex.id) == discoveryTime.end()) {
-        dfsArticulationPoints(vertex, discoveryTime, low, parent,
-                              articulationPoints);
-      }
+  std::vector<int> findArticulationPoints() const {
+    std::vector<int> result;
+    for (size_t v = 0; v < articulation.size(); ++v) {
+      if (articulation[v]) result.push_back(view.getVertex(v).id);
     }
-
-    return articulationPoints;
+    return result;
   }
 
- private:
-  Graph<VertexType, EdgeType> graph;  ///< Граф для анализа.
-  int time;  ///< Время обнаружения вершин (используется в DFS).
+  /**
+   * @brief Возвращает представление графа, по которому шёл поиск.
+   */
+  const AdjacencyView<VertexType>& getView() const { return view; }
 
   /**
-   * @brief Вспомогательная функция для поиска мостов с использованием DFS.
-   * @param u Текущая вершина.
-   * @param discoveryTime Время обнаружения вершин.
-   * @param low Минимальное время достижимости.
-   * @param parent Родительские вершины.
-   * @param bridges Вектор для хранения найденных мостов.
+   * @brief Возвращает число блоков (компонент двусвязности).
    */
-  void dfsBridges(const Vertex& u, std::unordered_map<int, int>& discoveryTime,
-                  std::unordered_map<int, int>& low,
-                  std::unordered_map<int, int>& parent,
-                  std::vector<EdgeType>& bridges) {
-    discoveryTime[u.id] = low[u.id] = ++time;
-
-    // Обход всех соседей текущей вершины.
-    for (auto& v : graph.getAdjacencyVertices(u)) {
-      if (discoveryTime.find(v.id) == discoveryTime.end()) {
-        parent[v.id] = u.id;
-        dfsBridges(v, discoveryTime, low, parent, bridges);
-
-        // Обновляем минимальное время достижимости.
-        low[u.id] = std::min(low[u.id], low[v.id]);
-
-        // Если условие для моста выполнено, добавляем ребро в список мостов.
-        if (low[v.id] > discoveryTime[u.id]) {
-          bridges.push_back(EdgeType(u, v));
-        }
-      } else if (v.id != parent[u.id]) {
-        // Обновляем минимальное время достижимости.
-        low[u.id] = std::min(low[u.id], discoveryTime[v.id]);
-      }
+  size_t blockCount() const { return blockHead.size(); }
+
+  /**
+   * @brief Возвращает блоки рёбер по позициям в массиве смежности getView().
+   *
+   * Оба направления ребра получают один номер; у петель — kNone.
+   */
+  const std::vector<uint32_t>& getEdgeBlocks() const { return edgeBlock; }
+
+  /**
+   * @brief Возвращает блок ребра по его позиции в массиве смежности.
+   */
+  uint32_t getEdgeBlock(size_t position) const { return edgeBlock[position]; }
+
+  /**
+   * @brief Возвращает вершины блока.
+   */
+  std::vector<VertexType> getBlockVertices(size_t b) const {
+    std::vector<VertexType> result{view.getVertex(blockHead[b])};
+    for (size_t i = blockOffsets[b]; i < blockOffsets[b + 1]; ++i) {
+      result.push_back(view.getVertex(blockMembers[i]));
     }
+    return result;
   }
 
   /**
-   * @brief Вспомогательная функция для поиска точек сочленения с использованием
-   * DFS.
-   * @param u Текущая вершина.
-   * @param discoveryTime Время обнаружения вершин.
-   * @param low Минимальное время достижимости.
-   * @param parent Родительские вершины.
-   * @param articulationPoints Вектор для хранения найденных точек сочленения.
+   * @brief Строит дерево блоков и точек сочленения.
+   *
+   * Вершины Vertex(b) при b < blockCount() — блоки, следующие за ними —
+   * точки сочленения в порядке findArticulationPoints(). Блок соединён с
+   * каждой своей точкой сочленения рёбрами в обе стороны, так что для
+   * каждой компоненты связности получается дерево.
+   *
+   * @return Симметричное представление леса блоков.
    */
-  void dfsArticulationPoints(const Vertex& u,
-                             std::unordered_map<int, int>& discoveryTime,
-                             std::unordered_map<int, int>& low,
-                             std::unordered_map<int, int>& parent,
-                             std::vector<int>& articulationPoints) {
-    discoveryTime[u.id] = low[u.id] = ++time;
-    int children = 0;  // Количество потомков в DFS-дереве.
-
-    // Обход всех соседей текущей вершины.
-    for (auto& v : graph.getAdjacencyVertices(u)) {
-      if (discoveryTime.find(v.id) == discoveryTime.end()) {
-        children++;
-        parent[v.id] = u.id;
-        dfsArticulationPoints(v, discoveryTime, low, parent,
-                              articulationPoints);
-
-        // Обновляем минимальное время достижимости.
-        low[u.id] = std::min(low[u.id], low[v.id]);
-
-        // Если вершина является корнем и имеет более одного потомка, это точка
-        // сочленения.
-        if (parent.find(u.id) == parent.end() && children > 1) {
-          articulationPoints.push_back(u.id);
-        }
+  AdjacencyView<Vertex> getBlockCutTree() const {
+    const size_t n = view.vertexCount();
+    const uint32_t blocks = static_cast<uint32_t>(blockCount());
+    std::vector<uint32_t> cutIndex(n, kNone);
+    uint32_t next = blocks;
+    for (size_t v = 0; v < n; ++v) {
+      if (articulation[v]) cutIndex[v] = next++;
+    }
+    std::vector<Vertex> vertices;
+    vertices.reserve(next);
+    for (uint32_t id = 0; id < next; ++id) {
+      vertices.emplace_back(static_cast<int>(id));
+    }
 
-        // Если вершина не является корнем и имеет потомка с low[v.id] >=
-        // discoveryTime[u.id], это точка сочленения.
-        if (parent.find(u.id) != parent.end() &&
-            low[v.id] >= discoveryTime[u.id]) {
-          articulationPoints.push_back(u.id);
+    // Точка сочленения входит в блок своего древесного ребра и в блоки,
+    // для которых она служит вершиной-головой
+    std::vector<std::pair<uint32_t, uint32_t>> edges;
+    auto link = [&](uint32_t b, uint32_t v) {
+      edges.emplace_back(b, cutIndex[v]);
+      edges.emplace_back(cutIndex[v], b);
+    };
+    for (uint32_t b = 0; b < blocks; ++b) {
+      if (articulation[blockHead[b]]) link(b, blockHead[b]);
+    }
+    for (uint32_t v = 0; v < n; ++v) {
+      if (articulation[v] && vertexBlock[v] != kNone) link(vertexBlock[v], v);
+    }
+    return AdjacencyView<Vertex>(std::move(vertices), edges);
+  }
+
+  static constexpr uint32_t kNone = static_cast<uint32_t>(-1);  ///< Нет.
+
+ private:
+  /**
+   * @brief Кадр стека обхода.
+   */
+  struct Frame {
+    uint32_t vertex;   ///< Индекс вершины.
+    uint32_t parent;   ///< Родитель в дереве поиска или kNone.
+    size_t cursor;     ///< Позиция следующего ребра в массиве смежности.
+    bool skipped;      ///< Ребро к родителю уже пропущено.
+  };
+
+  AdjacencyView<VertexType> view;  ///< Представление графа.
+  std::vector<std::pair<uint32_t, uint32_t>> bridges;  ///< Найденные мосты.
+  std::vector<char> articulation;  ///< Признак точки сочленения.
+  /// Блок древесного ребра, ведущего в вершину; kNone у корней.
+  std::vector<uint32_t> vertexBlock;
+  std::vector<uint32_t> blockHead;  ///< Верхняя вершина каждого блока.
+  std::vector<uint32_t> edgeBlock;  ///< Блоки рёбер по позициям.
+  std::vector<size_t> blockOffsets;    ///< Начало вершин каждого блока.
+  std::vector<uint32_t> blockMembers;  ///< Вершины блоков без голов.
+
+  /**
+   * @brief Итеративный поиск в глубину с подсчётом low-значений.
+   *
+   * Найденные вершины кладутся на стек; когда low[u] >= discoveryTime[p]
+   * для ребра дерева (p, u), вершины стека до u включительно образуют
+   * вместе с p новый блок.
+   */
+  void search() {
+    const size_t n = view.vertexCount();
+    std::vector<uint32_t> discoveryTime(n, kNone);
+    std::vector<uint32_t> low(n, 0);
+    articulation.assign(n, 0);
+    vertexBlock.assign(n, kNone);
+    std::vector<Frame> stack;
+    std::vector<uint32_t> visited;
+    uint32_t time = 0;
+
+    for (size_t root = 0; root < n; ++root) {
+      if (discoveryTime[root] != kNone) continue;
+      discoveryTime[root] = low[root] = time++;
+      stack.push_back(
+          Frame{static_cast<uint32_t>(root), kNone, view.begin(root), false});
+      size_t rootChildren = 0;
+
+      while (!stack.empty()) {
+        Frame& frame = stack.back();
+        const uint32_t u = frame.vertex;
+        if (frame.cursor < view.end(u)) {
+          const uint32_t w = view.neighbor(frame.cursor++);
+          if (w == frame.parent && !frame.skipped) {
+            frame.skipped = true;
+            continue;
+          }
+          if (discoveryTime[w] == kNone) {
+            if (u == root) ++rootChildren;
+            discoveryTime[w] = low[w] = time++;
+            stack.push_back(Frame{w, u, view.begin(w), false});
+            visited.push_back(w);
+          } else {
+            low[u] = std::min(low[u], discoveryTime[w]);
+          }
+          continue;
         }
-      } else if (v.id != parent[u.id]) {
-        // Обновляем минимальное время достижимости.
-        low[u.id] = std::min(low[u.id], discoveryTime[v.id]);
+
+        const uint32_t p = frame.parent;
+        stack.pop_back();
+        if (p == kNone) continue;
+        low[p] = std::min(low[p], low[u]);
+        if (low[u] > discoveryTime[p]) bridges.emplace_back(p, u);
+        if (low[u] < discoveryTime[p]) continue;
+        if (p != root) articulation[p] = 1;
+        const uint32_t block = static_cast<uint32_t>(blockHead.size());
+        blockHead.push_back(p);
+        blockOffsets.push_back(blockMembers.size());
+        uint32_t x;
+        do {
+          x = visited.back();
+          visited.pop_back();
+          vertexBlock[x] = block;
+          blockMembers.push_back(x);
+        } while (x != u);
+      }
+      if (rootChildren > 1) articulation[root] = 1;
+    }
+    blockOffsets.push_back(blockMembers.size());
+
+    // Ребро попадает в блок своего более глубокого конца
+    edgeBlock.assign(view.edgeCount(), kNone);
+    for (size_t u = 0; u < n; ++u) {
+      for (size_t i = view.begin(u); i < view.end(u); ++i) {
+        const uint32_t w = view.neighbor(i);
+        if (w == u) continue;
+        edgeBlock[i] = vertexBlock[discoveryTime[u] > discoveryTime[w] ? u : w];
       }
     }
   }
@@ -152,4 +255,4 @@ class BridgesAndArticulationPoints {
 
 }  // namespace graph
 
-#endif  // BRIDGES_AND_ARTICULATION_POINTS_H
\ No newline at end of file
+#endif  // BRIDGES_AND_ARTICULATION_POINTS_H
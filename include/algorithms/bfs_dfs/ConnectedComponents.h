@@ -0,0 +1,116 @@
+#ifndef CONNECTED_COMPONENTS_H
+#define CONNECTED_COMPONENTS_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "AdjacencyView.h"
+
+namespace graph {
+
+/**
+ * @class ConnectedComponents
+ * @brief Компоненты связности графа на системе непересекающихся множеств.
+ *
+ * Каждое ребро объединяет множества своих концов (объединение по размеру,
+ * сжатие путей делением пополам), так что направление рёбер не важно: для
+ * ориентированного графа получаются компоненты слабой связности. Обход
+ * выполняется один раз по массиву смежности AdjacencyView, без копирования
+ * списков соседей и хеш-множеств посещённых вершин.
+ *
+ * Номера компонент плотные: компоненты нумеруются в порядке наименьшего
+ * индекса своих вершин, как и в ParallelConnectedComponents.
+ *
+ * @tparam VertexType Тип вершины.
+ */
+template <typename VertexType = Vertex>
+class ConnectedComponents {
+ public:
+  /**
+   * @brief Находит компоненты связности.
+   * @param view Представление графа.
+   */
+  explicit ConnectedComponents(const AdjacencyView<VertexType>& view) {
+    const size_t n = view.vertexCount();
+    parent.resize(n);
+    size.assign(n, 1);
+    for (size_t v = 0; v < n; ++v) {
+      parent[v] = static_cast<uint32_t>(v);
+    }
+    for (size_t u = 0; u < n; ++u) {
+      for (size_t i = view.begin(u); i < view.end(u); ++i) {
+        unite(static_cast<uint32_t>(u), view.neighbor(i));
+      }
+    }
+    relabel();
+  }
+
+  /**
+   * @brief Возвращает число компонент.
+   */
+  size_t componentCount() const { return count; }
+
+  /**
+   * @brief Возвращает номера компонент по индексам вершин представления.
+   */
+  const std::vector<uint32_t>& getComponents() const { return component; }
+
+  /**
+   * @brief Возвращает номер компоненты вершины по её индексу.
+   */
+  uint32_t getComponent(size_t v) const { return component[v]; }
+
+ private:
+  static constexpr uint32_t kNone = static_cast<uint32_t>(-1);  ///< Нет.
+
+  std::vector<uint32_t> parent;     ///< Родители в лесу множеств.
+  std::vector<uint32_t> size;       ///< Размеры множеств у корней.
+  std::vector<uint32_t> component;  ///< Плотные номера компонент.
+  size_t count = 0;                 ///< Число компонент.
+
+  /**
+   * @brief Находит корень множества, сокращая путь делением пополам.
+   */
+  uint32_t find(uint32_t v) {
+    while (parent[v] != v) {
+      parent[v] = parent[parent[v]];
+      v = parent[v];
+    }
+    return v;
+  }
+
+  /**
+   * @brief Объединяет множества двух вершин.
+   */
+  void unite(uint32_t u, uint32_t v) {
+    u = find(u);
+    v = find(v);
+    if (u == v) return;
+    if (size[u] < size[v]) std::swap(u, v);
+    parent[v] = u;
+    size[u] += size[v];
+  }
+
+  /**
+   * @brief Переводит корни множеств в плотные номера компонент.
+   */
+  void relabel() {
+    const size_t n = parent.size();
+    std::vector<uint32_t> dense(n, kNone);
+    component.resize(n);
+    for (size_t v = 0; v < n; ++v) {
+      uint32_t r = find(static_cast<uint32_t>(v));
+      if (dense[r] == kNone) dense[r] = static_cast<uint32_t>(count++);
+      component[v] = dense[r];
+    }
+    parent.clear();
+    parent.shrink_to_fit();
+    size.clear();
+    size.shrink_to_fit();
+  }
+};
+
+}  // namespace graph
+
+#endif  // CONNECTED_COMPONENTS_H
@@ -1,57 +1,338 @@
 #ifndef DFS_H
 #define DFS_H
 
-#include <stack>
-#include <unordered_set>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
 
+#include "AdjacencyView.h"
 #include "Graph.h"
 #include "Visitor.h"
 
 namespace graph {
 
 /**
- * @brief Реализация алгоритма поиска в глубину (DFS).
+ * @class DepthFirstSearch
+ * @brief Итеративный поиск в глубину по представлению AdjacencyView.
+ *
+ * Обход ведётся явным стеком пар (вершина, позиция следующего ребра), так что
+ * глубина ограничена только памятью. Цвета, времена входа и выхода и
+ * родители хранятся в плотных массивах по индексам вершин и сохраняются
+ * между вызовами visit(), поэтому обход из нескольких корней продолжает уже
+ * посещённое.
+ *
+ * Посетитель получает индексы вершин (удобно наследовать NullVisitor<size_t>)
+ * и может вернуть VisitorAction:
+ * - discoverVertex — вершина стала серой; SkipChildren завершает её сразу;
+ * - examineEdge — очередное исходящее ребро; SkipChildren пропускает его;
+ * - treeEdge — ребро в белую вершину; SkipChildren не раскрывает её;
+ * - backEdge — ребро в серую вершину (предка);
+ * - forwardEdge, crossEdge — ребро в чёрную вершину: потомка или вершину
+ *   другого поддерева;
+ * - finishVertex — вершина стала чёрной.
+ * Stop в любом событии завершает обход; состояние остаётся частичным до
+ * вызова reset().
+ *
+ * В неориентированном графе ребро к родителю тоже встречается как обратное.
+ *
  * @tparam VertexType Тип вершины.
- * @tparam EdgeType Тип ребра.
- * @param graph Граф, по которому выполняется поиск.
- * @param startVertex Начальная вершина для поиска.
- * @param visitor Посетитель (Visitor), который обрабатывает события DFS.
- * @return Множество посещённых вершин.
  */
-template <typename VertexType, typename EdgeType>
-std::unordered_set<Vertex> DFS(Graph<VertexType, EdgeType>& graph,
-                               const Vertex& startVertex,
-                               Visitor<VertexType, EdgeType>& visitor) {
-  std::stack<Vertex> stack;
-  std::unordered_set<Vertex> visited;
+template <typename VertexType = Vertex>
+class DepthFirstSearch {
+ public:
+  static constexpr uint32_t kNone = static_cast<uint32_t>(-1);  ///< Нет.
+
+  /**
+   * @brief Цвет вершины в поиске в глубину.
+   */
+  enum class Color : uint8_t {
+    White,  ///< Вершина не найдена.
+    Gray,   ///< Вершина на стеке обхода.
+    Black   ///< Вершина завершена.
+  };
 
-  stack.push(startVertex);
-  visited.insert(startVertex);
+  /**
+   * @brief Конструктор.
+   * @param view Представление графа; должно жить дольше обхода.
+   */
+  explicit DepthFirstSearch(const AdjacencyView<VertexType>& view)
+      : view(view) {
+    reset();
+  }
 
-  while (!stack.empty()) {
-    Vertex currentVertex = stack.top();
-    stack.pop();
+  /**
+   * @brief Сбрасывает состояние: все вершины снова белые.
+   */
+  void reset() {
+    const size_t n = view.vertexCount();
+    color.assign(n, Color::White);
+    discover.assign(n, kNone);
+    finish.assign(n, kNone);
+    parent.assign(n, kNone);
+    stack.clear();
+    time = 0;
+  }
 
-    visitor.visitVertex(currentVertex);
+  /**
+   * @brief Обходит вершины, достижимые из корня.
+   *
+   * @param root Индекс корня; если он уже посещён, ничего не происходит.
+   * @param visitor Посетитель.
+   * @return false, если посетитель остановил обход.
+   */
+  template <typename VisitorType>
+  bool visit(size_t root, VisitorType& visitor) {
+    stack.clear();
+    if (color[root] != Color::White) return true;
+    if (!discoverVertex(root, false, visitor)) return false;
 
-    auto neighbors = graph.getAdjacencyVertices(currentVertex);
-    for (auto& vertex : neighbors) {
-      visitor.examineEdge(EdgeType(currentVertex, vertex));
+    while (!stack.empty()) {
+      Frame& frame = stack.back();
+      const size_t u = frame.vertex;
+      if (frame.cursor == view.end(u)) {
+        stack.pop_back();
+        color[u] = Color::Black;
+        finish[u] = time++;
+        if (visitorAction([&] { return visitor.finishVertex(u); }) ==
+            VisitorAction::Stop) {
+          return false;
+        }
+        continue;
+      }
 
-      if (visited.find(vertex) == visited.end()) {
-        visited.insert(vertex);
-        stack.push(vertex);
+      const size_t v = view.neighbor(frame.cursor++);
+      VisitorAction action =
+          visitorAction([&] { return visitor.examineEdge(u, v); });
+      if (action == VisitorAction::Stop) return false;
+      if (action == VisitorAction::SkipChildren) continue;
 
-        visitor.treeEdge(EdgeType(currentVertex, vertex));
+      if (color[v] == Color::White) {
+        action = visitorAction([&] { return visitor.treeEdge(u, v); });
+        if (action == VisitorAction::Stop) return false;
+        parent[v] = static_cast<uint32_t>(u);
+        bool skip = action == VisitorAction::SkipChildren;
+        if (!discoverVertex(v, skip, visitor)) return false;
+      } else if (color[v] == Color::Gray) {
+        action = visitorAction([&] { return visitor.backEdge(u, v); });
+      } else if (discover[u] < discover[v]) {
+        action = visitorAction([&] { return visitor.forwardEdge(u, v); });
+      } else {
+        action = visitorAction([&] { return visitor.crossEdge(u, v); });
       }
+      if (action == VisitorAction::Stop) return false;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Обходит весь граф, запуская поиск из белых вершин по порядку.
+   *
+   * @param visitor Посетитель.
+   * @return false, если посетитель остановил обход.
+   */
+  template <typename VisitorType>
+  bool visitAll(VisitorType& visitor) {
+    for (size_t root = 0; root < view.vertexCount(); ++root) {
+      if (!visit(root, visitor)) return false;
     }
+    return true;
+  }
+
+  /**
+   * @brief Возвращает цвет вершины.
+   */
+  Color getColor(size_t v) const { return color[v]; }
+
+  /**
+   * @brief Возвращает время входа в вершину или kNone.
+   */
+  uint32_t getDiscoverTime(size_t v) const { return discover[v]; }
+
+  /**
+   * @brief Возвращает время выхода из вершины или kNone.
+   */
+  uint32_t getFinishTime(size_t v) const { return finish[v]; }
+
+  /**
+   * @brief Возвращает родителя вершины в дереве поиска или kNone.
+   */
+  uint32_t getParent(size_t v) const { return parent[v]; }
+
+ private:
+  /**
+   * @brief Кадр стека обхода.
+   */
+  struct Frame {
+    uint32_t vertex;  ///< Индекс вершины.
+    size_t cursor;    ///< Позиция следующего ребра в массиве смежности.
+  };
+
+  const AdjacencyView<VertexType>& view;  ///< Представление графа.
+  std::vector<Color> color;        ///< Цвета вершин.
+  std::vector<uint32_t> discover;  ///< Времена входа.
+  std::vector<uint32_t> finish;    ///< Времена выхода.
+  std::vector<uint32_t> parent;    ///< Родители в дереве поиска.
+  std::vector<Frame> stack;        ///< Стек обхода.
+  uint32_t time = 0;               ///< Счётчик событий входа и выхода.
+
+  /**
+   * @brief Делает вершину серой и кладёт её на стек.
+   *
+   * @param v Индекс вершины.
+   * @param skip Не раскрывать вершину.
+   * @param visitor Посетитель.
+   * @return false, если посетитель остановил обход.
+   */
+  template <typename VisitorType>
+  bool discoverVertex(size_t v, bool skip, VisitorType& visitor) {
+    color[v] = Color::Gray;
+    discover[v] = time++;
+    stack.push_back(Frame{static_cast<uint32_t>(v), view.begin(v)});
+    VisitorAction action =
+        visitorAction([&] { return visitor.discoverVertex(v); });
+    if (action == VisitorAction::Stop) return false;
+    if (skip || action == VisitorAction::SkipChildren) {
+      stack.back().cursor = view.end(v);
+    }
+    return true;
+  }
+};
+
+/**
+ * @brief Переводит события обхода по индексам в события по вершинам.
+ *
+ * Используется функцией DFS: найденные вершины записываются в порядке
+ * входа, а за discoverVertex посетителя следует visitVertex.
+ *
+ * @tparam VertexType Тип вершины.
+ * @tparam VisitorType Тип посетителя вершин.
+ */
+template <typename VertexType, typename VisitorType>
+class IndexToVertexVisitor {
+ public:
+  /**
+   * @brief Конструктор.
+   * @param view Представление графа.
+   * @param visitor Посетитель вершин.
+   * @param order Куда записывать найденные вершины.
+   */
+  IndexToVertexVisitor(const AdjacencyView<VertexType>& view,
+                       VisitorType& visitor, std::vector<VertexType>& order)
+      : view(view), visitor(visitor), order(order) {}
+
+  /**
+   * @brief Пересылает обнаружение вершины и её посещение.
+   */
+  VisitorAction discoverVertex(size_t v) {
+    const VertexType& vertex = view.getVertex(v);
+    order.push_back(vertex);
+    VisitorAction action =
+        visitorAction([&] { return visitor.discoverVertex(vertex); });
+    if (action != VisitorAction::Continue) return action;
+    return visitorAction([&] { return visitor.visitVertex(vertex); });
+  }
+
+  /**
+   * @brief Пересылает исследование ребра.
+   */
+  VisitorAction examineEdge(size_t u, size_t v) {
+    return visitorAction([&] {
+      return visitor.examineEdge(view.getVertex(u), view.getVertex(v));
+    });
+  }
+
+  /**
+   * @brief Пересылает ребро дерева поиска.
+   */
+  VisitorAction treeEdge(size_t u, size_t v) {
+    return visitorAction([&] {
+      return visitor.treeEdge(view.getVertex(u), view.getVertex(v));
+    });
+  }
+
+  /**
+   * @brief Пересылает обратное ребро.
+   */
+  VisitorAction backEdge(size_t u, size_t v) {
+    return visitorAction([&] {
+      return visitor.backEdge(view.getVertex(u), view.getVertex(v));
+    });
+  }
+
+  /**
+   * @brief Пересылает прямое ребро.
+   */
+  VisitorAction forwardEdge(size_t u, size_t v) {
+    return visitorAction([&] {
+      return visitor.forwardEdge(view.getVertex(u), view.getVertex(v));
+    });
+  }
 
-    visitor.finishVertex(currentVertex);
+  /**
+   * @brief Пересылает перекрёстное ребро.
+   */
+  VisitorAction crossEdge(size_t u, size_t v) {
+    return visitorAction([&] {
+      return visitor.crossEdge(view.getVertex(u), view.getVertex(v));
+    });
   }
 
-  return visited;
+  /**
+   * @brief Пересылает завершение вершины.
+   */
+  VisitorAction finishVertex(size_t v) {
+    return visitorAction(
+        [&] { return visitor.finishVertex(view.getVertex(v)); });
+  }
+
+ private:
+  const AdjacencyView<VertexType>& view;  ///< Представление графа.
+  VisitorType& visitor;                   ///< Посетитель вершин.
+  std::vector<VertexType>& order;         ///< Найденные вершины.
+};
+
+/**
+ * @brief Реализация алгоритма поиска в глубину (DFS).
+ *
+ * Граф один раз переводится в AdjacencyView, после чего обход выполняет
+ * DepthFirstSearch: вершина считается посещённой при входе в неё, а не при
+ * попадании на стек, так что порядок и события соответствуют настоящему
+ * поиску в глубину. Помимо событий BFS посетитель получает discoverVertex
+ * (сразу за ним — visitVertex), backEdge, forwardEdge и crossEdge.
+ *
+ * Методы посетителя вызываются статически, так что пустые обработчики
+ * (NullVisitor) ничего не стоят. Наследники виртуального Visitor
+ * оборачиваются в VisitorAdapter. Управляющие коды VisitorAction описаны в
+ * DepthFirstSearch.
+ *
+ * @tparam VertexType Тип вершины.
+ * @tparam EdgeType Тип ребра.
+ * @tparam VisitorType Тип посетителя.
+ * @param graph Граф, по которому выполняется поиск.
+ * @param startVertex Начальная вершина для поиска.
+ * @param visitor Посетитель, который обрабатывает события DFS.
+ * @return Посещённые вершины в порядке входа.
+ * @throws std::out_of_range Если начальной вершины нет в графе.
+ */
+template <typename VertexType, typename EdgeType, typename VisitorType>
+std::vector<VertexType> DFS(const Graph<VertexType, EdgeType>& graph,
+                            const VertexType& startVertex,
+                            VisitorType& visitor) {
+  if constexpr (std::is_base_of_v<Visitor<VertexType, EdgeType>,
+                                  VisitorType>) {
+    VisitorAdapter<VertexType, EdgeType> adapter(visitor);
+    return DFS(graph, startVertex, adapter);
+  } else {
+    AdjacencyView<VertexType> view(graph);
+    std::vector<VertexType> order;
+    IndexToVertexVisitor<VertexType, VisitorType> bridge(view, visitor,
+                                                         order);
+    DepthFirstSearch<VertexType> search(view);
+    search.visit(view.getIndex(startVertex), bridge);
+    return order;
+  }
 }
 
 }  // namespace graph
 
-#endif  // DFS_H
\ No newline at end of file
+#endif  // DFS_H
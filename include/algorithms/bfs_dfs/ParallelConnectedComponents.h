@@ -0,0 +1,204 @@
+#ifndef PARALLEL_CONNECTED_COMPONENTS_H
+#define PARALLEL_CONNECTED_COMPONENTS_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "../parallel/ParallelFor.h"
+#include "AdjacencyView.h"
+
+namespace graph {
+
+/**
+ * @class ParallelConnectedComponents
+ * @brief Многопоточные компоненты связности неориентированного графа.
+ *
+ * Алгоритм Afforest (Sutton, Ben-Nun, Barak) — развитие схемы
+ * Шилоаха-Вишкина:
+ * 1. Выборка подграфа: несколько раундов, в каждом вершина подвешивается к
+ *    очередному своему соседу, после раунда деревья сжимаются. Обычно уже
+ *    этого хватает, чтобы собрать гигантскую компоненту.
+ * 2. По случайной выборке вершин определяется самая частая компонента.
+ * 3. Оставшиеся рёбра просматриваются только у вершин вне неё: рёбра внутри
+ *    гигантской компоненты больше ничего не меняют.
+ * Подвешивание свободно от блокировок: корень с большим номером
+ * переставляется на меньший через compare-and-swap, при неудаче попытка
+ * повторяется с обновлёнными корнями.
+ *
+ * Представление должно быть симметричным: на этапе 3 ребро из гигантской
+ * компоненты учитывается со стороны второго конца. Для графов, хранящих
+ * ребро в одну сторону, его даёт AdjacencyView::symmetrize().
+ *
+ * Номера компонент плотные и не зависят от числа потоков: компоненты
+ * нумеруются в порядке наименьшего индекса своих вершин, как и в
+ * ConnectedComponents.
+ *
+ * @tparam VertexType Тип вершины.
+ */
+template <typename VertexType = Vertex>
+class ParallelConnectedComponents {
+ public:
+  /**
+   * @brief Находит компоненты связности.
+   *
+   * @param view Симметричное представление графа.
+   * @param threadCount Число потоков.
+   */
+  explicit ParallelConnectedComponents(
+      const AdjacencyView<VertexType>& view,
+      size_t threadCount = defaultThreadCount())
+      : view(view),
+        threads(std::max<size_t>(threadCount, 1)),
+        n(view.vertexCount()),
+        parent(n) {
+    parallelFor(0, n, threads, [&](size_t v) {
+      parent[v].store(static_cast<uint32_t>(v), std::memory_order_relaxed);
+    }, kGrain);
+    sampleNeighbors();
+    linkRemaining(largestComponent());
+    relabel();
+  }
+
+  /**
+   * @brief Возвращает число компонент.
+   */
+  size_t componentCount() const { return count; }
+
+  /**
+   * @brief Возвращает номера компонент по индексам вершин представления.
+   */
+  const std::vector<uint32_t>& getComponents() const { return component; }
+
+  /**
+   * @brief Возвращает номер компоненты вершины по её индексу.
+   */
+  uint32_t getComponent(size_t v) const { return component[v]; }
+
+ private:
+  static constexpr uint32_t kNone = static_cast<uint32_t>(-1);  ///< Нет.
+  static constexpr size_t kGrain = 256;          ///< Блок вершин для потока.
+  static constexpr size_t kNeighborRounds = 2;   ///< Раунды выборки.
+  static constexpr size_t kSampleSize = 1024;    ///< Размер выборки вершин.
+
+  const AdjacencyView<VertexType>& view;  ///< Представление графа.
+  size_t threads;                         ///< Число потоков.
+  size_t n;                               ///< Число вершин.
+  /// Родитель в лесу компонент; корень — вершина с наименьшим индексом.
+  std::vector<std::atomic<uint32_t>> parent;
+  std::vector<uint32_t> component;  ///< Плотные номера компонент.
+  size_t count = 0;                 ///< Число компонент.
+
+  /**
+   * @brief Загружает родителя вершины.
+   */
+  uint32_t load(uint32_t v) const {
+    return parent[v].load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Подвешивает деревья двух вершин друг к другу.
+   *
+   * Корень с большим номером переставляется на меньший; если его успели
+   * переподвесить, попытка повторяется от новых родителей.
+   */
+  void link(uint32_t u, uint32_t v) {
+    uint32_t p1 = load(u);
+    uint32_t p2 = load(v);
+    while (p1 != p2) {
+      uint32_t high = std::max(p1, p2);
+      uint32_t low = std::min(p1, p2);
+      uint32_t expected = load(high);
+      if (expected == low) break;
+      if (expected == high &&
+          parent[high].compare_exchange_strong(expected, low,
+                                               std::memory_order_relaxed)) {
+        break;
+      }
+      p1 = load(load(high));
+      p2 = load(low);
+    }
+  }
+
+  /**
+   * @brief Сжимает пути: каждая вершина подвешивается прямо к корню.
+   */
+  void compress() {
+    parallelFor(0, n, threads, [&](size_t v) {
+      uint32_t p = load(static_cast<uint32_t>(v));
+      while (p != load(p)) {
+        p = load(p);
+      }
+      parent[v].store(p, std::memory_order_relaxed);
+    }, kGrain);
+  }
+
+  /**
+   * @brief Этап 1: подвешивание к первым соседям раунд за раундом.
+   */
+  void sampleNeighbors() {
+    for (size_t r = 0; r < kNeighborRounds; ++r) {
+      parallelFor(0, n, threads, [&](size_t v) {
+        if (view.degree(v) > r) {
+          link(static_cast<uint32_t>(v), view.neighbor(view.begin(v) + r));
+        }
+      }, kGrain);
+      compress();
+    }
+  }
+
+  /**
+   * @brief Этап 2: самая частая компонента в случайной выборке вершин.
+   */
+  uint32_t largestComponent() const {
+    if (n == 0) return kNone;
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<size_t> pick(0, n - 1);
+    std::unordered_map<uint32_t, size_t> frequency;
+    uint32_t best = kNone;
+    size_t bestCount = 0;
+    for (size_t i = 0; i < kSampleSize; ++i) {
+      uint32_t c = load(static_cast<uint32_t>(pick(rng)));
+      size_t seen = ++frequency[c];
+      if (seen > bestCount) {
+        best = c;
+        bestCount = seen;
+      }
+    }
+    return best;
+  }
+
+  /**
+   * @brief Этап 3: оставшиеся рёбра вершин вне самой частой компоненты.
+   */
+  void linkRemaining(uint32_t skip) {
+    parallelFor(0, n, threads, [&](size_t v) {
+      if (load(static_cast<uint32_t>(v)) == skip) return;
+      for (size_t i = view.begin(v) + kNeighborRounds; i < view.end(v); ++i) {
+        link(static_cast<uint32_t>(v), view.neighbor(i));
+      }
+    }, kGrain);
+    compress();
+  }
+
+  /**
+   * @brief Переводит корни в плотные номера компонент.
+   *
+   * После сжатия родитель каждой вершины — наименьший индекс её компоненты,
+   * поэтому компонента получает номер при встрече со своим корнем.
+   */
+  void relabel() {
+    component.resize(n);
+    for (size_t v = 0; v < n; ++v) {
+      uint32_t r = load(static_cast<uint32_t>(v));
+      component[v] = r == v ? static_cast<uint32_t>(count++) : component[r];
+    }
+  }
+};
+
+}  // namespace graph
+
+#endif  // PARALLEL_CONNECTED_COMPONENTS_H
@@ -0,0 +1,301 @@
+#ifndef PARALLEL_STRONGLY_CONNECTED_COMPONENTS_H
+#define PARALLEL_STRONGLY_CONNECTED_COMPONENTS_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "../parallel/ParallelFor.h"
+#include "AdjacencyView.h"
+
+namespace graph {
+
+/**
+ * @class ParallelStronglyConnectedComponents
+ * @brief Многопоточное разбиение ориентированного графа на компоненты
+ * сильной связности.
+ *
+ * Схема Multistep (Slota, Rajamanickam, Madduri) из трёх этапов:
+ * 1. Обрезка: вершина без входящих или без исходящих рёбер среди
+ *    оставшихся — отдельная компонента. Степени хранятся атомарными
+ *    счётчиками, обрезка идёт параллельными волнами, пока появляются новые
+ *    такие вершины.
+ * 2. Forward-backward: из опорной вершины с наибольшим произведением
+ *    степеней выполняется параллельный BFS по прямым рёбрам, затем
+ *    обратный BFS по транспонированному графу внутри найденного множества —
+ *    он и есть компонента опорной вершины (обычно гигантская).
+ * 3. Раскраска: каждая оставшаяся вершина получает цвет, равный своему
+ *    индексу, и максимум цвета параллельно распространяется по рёбрам до
+ *    неподвижной точки. Вершина, сохранившая свой цвет, — корень: обратный
+ *    обход из неё внутри своего цвета даёт её компоненту. Обходы разных
+ *    корней не пересекаются и выполняются параллельно; этап повторяется,
+ *    пока вершины не кончатся.
+ *
+ * Номера компонент плотные и не зависят от числа потоков: компоненты
+ * нумеруются в порядке наименьшего индекса своих вершин.
+ *
+ * @tparam VertexType Тип вершины.
+ */
+template <typename VertexType = Vertex>
+class ParallelStronglyConnectedComponents {
+ public:
+  /**
+   * @brief Находит компоненты сильной связности.
+   *
+   * @param view Представление графа.
+   * @param threadCount Число потоков.
+   */
+  explicit ParallelStronglyConnectedComponents(
+      const AdjacencyView<VertexType>& view,
+      size_t threadCount = defaultThreadCount())
+      : view(view),
+        reverse(view.transpose()),
+        team(threadCount),
+        n(view.vertexCount()),
+        owner(n),
+        localLists(team.size()) {
+    team.forEach(0, n, [&](size_t v, size_t) {
+      owner[v].store(kNone, std::memory_order_relaxed);
+    }, kGrain);
+    trim();
+    forwardBackward();
+    colorRemaining();
+    relabel();
+  }
+
+  /**
+   * @brief Возвращает число компонент.
+   */
+  size_t componentCount() const { return count; }
+
+  /**
+   * @brief Возвращает номера компонент по индексам вершин представления.
+   */
+  const std::vector<uint32_t>& getComponents() const { return component; }
+
+  /**
+   * @brief Возвращает номер компоненты вершины по её индексу.
+   */
+  uint32_t getComponent(size_t v) const { return component[v]; }
+
+ private:
+  static constexpr uint32_t kNone = static_cast<uint32_t>(-1);  ///< Нет.
+  static constexpr size_t kGrain = 256;  ///< Блок вершин для потока.
+
+  const AdjacencyView<VertexType>& view;  ///< Представление графа.
+  AdjacencyView<VertexType> reverse;      ///< Транспонированный граф.
+  WorkerTeam team;                        ///< Потоки разбиения.
+  size_t n;                               ///< Число вершин.
+  /// Представитель компоненты вершины или kNone, пока она не найдена.
+  std::vector<std::atomic<uint32_t>> owner;
+  std::vector<std::vector<uint32_t>> localLists;  ///< Списки по потокам.
+  std::vector<uint32_t> component;  ///< Плотные номера компонент.
+  size_t count = 0;                 ///< Число компонент.
+
+  /**
+   * @brief Назначает вершине представителя, если она ещё свободна.
+   * @return true, если назначение выполнил этот вызов.
+   */
+  bool claim(uint32_t v, uint32_t representative) {
+    uint32_t expected = kNone;
+    return owner[v].compare_exchange_strong(expected, representative,
+                                            std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Проверяет, что вершина ещё не отнесена к компоненте.
+   */
+  bool isFree(uint32_t v) const {
+    return owner[v].load(std::memory_order_relaxed) == kNone;
+  }
+
+  /**
+   * @brief Параллельно обрабатывает фронт, собирая следующий из списков
+   * потоков.
+   *
+   * @param frontier Текущий фронт; заменяется следующим.
+   * @param expand Функция expand(v, list) раскрытия вершины.
+   */
+  template <typename Expand>
+  void advance(std::vector<uint32_t>& frontier, Expand&& expand) {
+    advanceFrontier(
+        team, frontier, localLists,
+        [&](uint32_t v, size_t worker) { expand(v, localLists[worker]); },
+        kGrain);
+  }
+
+  /**
+   * @brief Отсекает вершины без входящих или исходящих рёбер волнами.
+   */
+  void trim() {
+    std::vector<std::atomic<uint32_t>> in(n);
+    std::vector<std::atomic<uint32_t>> out(n);
+    team.forEach(0, n, [&](size_t v, size_t) {
+      in[v].store(static_cast<uint32_t>(reverse.degree(v)),
+                  std::memory_order_relaxed);
+      out[v].store(static_cast<uint32_t>(view.degree(v)),
+                   std::memory_order_relaxed);
+    }, kGrain);
+
+    std::vector<uint32_t> frontier;
+    for (uint32_t v = 0; v < n; ++v) {
+      if ((view.degree(v) == 0 || reverse.degree(v) == 0) && claim(v, v)) {
+        frontier.push_back(v);
+      }
+    }
+    // Удалённая вершина уменьшает степени соседей; обнулившиеся — следующие
+    while (!frontier.empty()) {
+      advance(frontier, [&](uint32_t v, std::vector<uint32_t>& list) {
+        for (size_t i = view.begin(v); i < view.end(v); ++i) {
+          uint32_t w = view.neighbor(i);
+          if (in[w].fetch_sub(1, std::memory_order_relaxed) == 1 &&
+              claim(w, w)) {
+            list.push_back(w);
+          }
+        }
+        for (size_t i = reverse.begin(v); i < reverse.end(v); ++i) {
+          uint32_t w = reverse.neighbor(i);
+          if (out[w].fetch_sub(1, std::memory_order_relaxed) == 1 &&
+              claim(w, w)) {
+            list.push_back(w);
+          }
+        }
+      });
+    }
+  }
+
+  /**
+   * @brief Выделяет компоненту опорной вершины прямым и обратным BFS.
+   */
+  void forwardBackward() {
+    uint32_t pivot = kNone;
+    uint64_t best = 0;
+    for (uint32_t v = 0; v < n; ++v) {
+      if (!isFree(v)) continue;
+      uint64_t score = static_cast<uint64_t>(view.degree(v)) *
+                       static_cast<uint64_t>(reverse.degree(v));
+      if (pivot == kNone || score > best) {
+        pivot = v;
+        best = score;
+      }
+    }
+    if (pivot == kNone) return;
+
+    std::vector<std::atomic<uint8_t>> forward(n);
+    team.forEach(0, n, [&](size_t v, size_t) {
+      forward[v].store(0, std::memory_order_relaxed);
+    }, kGrain);
+    forward[pivot].store(1, std::memory_order_relaxed);
+    std::vector<uint32_t> frontier{pivot};
+    while (!frontier.empty()) {
+      advance(frontier, [&](uint32_t v, std::vector<uint32_t>& list) {
+        for (size_t i = view.begin(v); i < view.end(v); ++i) {
+          uint32_t w = view.neighbor(i);
+          if (!isFree(w) || forward[w].load(std::memory_order_relaxed)) {
+            continue;
+          }
+          if (forward[w].exchange(1, std::memory_order_relaxed) == 0) {
+            list.push_back(w);
+          }
+        }
+      });
+    }
+
+    // Обратный обход внутри прямого множества
+    claim(pivot, pivot);
+    frontier.assign(1, pivot);
+    while (!frontier.empty()) {
+      advance(frontier, [&](uint32_t v, std::vector<uint32_t>& list) {
+        for (size_t i = reverse.begin(v); i < reverse.end(v); ++i) {
+          uint32_t w = reverse.neighbor(i);
+          if (forward[w].load(std::memory_order_relaxed) &&
+              claim(w, pivot)) {
+            list.push_back(w);
+          }
+        }
+      });
+    }
+  }
+
+  /**
+   * @brief Разбирает оставшиеся вершины раскраской.
+   */
+  void colorRemaining() {
+    std::vector<uint32_t> rest;
+    for (uint32_t v = 0; v < n; ++v) {
+      if (isFree(v)) rest.push_back(v);
+    }
+    std::vector<std::atomic<uint32_t>> color(n);
+
+    while (!rest.empty()) {
+      team.forEach(0, rest.size(), [&](size_t i, size_t) {
+        color[rest[i]].store(rest[i], std::memory_order_relaxed);
+      }, kGrain);
+
+      // Распространяем максимум цвета по рёбрам между свободными вершинами
+      std::atomic<bool> changed{true};
+      while (changed.load(std::memory_order_relaxed)) {
+        changed.store(false, std::memory_order_relaxed);
+        team.forEach(0, rest.size(), [&](size_t i, size_t) {
+          uint32_t v = rest[i];
+          uint32_t c = color[v].load(std::memory_order_relaxed);
+          for (size_t j = view.begin(v); j < view.end(v); ++j) {
+            uint32_t w = view.neighbor(j);
+            if (!isFree(w)) continue;
+            uint32_t current = color[w].load(std::memory_order_relaxed);
+            while (current < c &&
+                   !color[w].compare_exchange_weak(
+                       current, c, std::memory_order_relaxed)) {
+            }
+            if (current < c) changed.store(true, std::memory_order_relaxed);
+          }
+        }, kGrain);
+      }
+
+      std::vector<uint32_t> roots;
+      for (uint32_t v : rest) {
+        if (color[v].load(std::memory_order_relaxed) == v) roots.push_back(v);
+      }
+      // Обходы разных корней идут по непересекающимся цветам
+      team.forEach(0, roots.size(), [&](size_t r, size_t) {
+        const uint32_t root = roots[r];
+        std::vector<uint32_t> stack{root};
+        claim(root, root);
+        while (!stack.empty()) {
+          uint32_t v = stack.back();
+          stack.pop_back();
+          for (size_t i = reverse.begin(v); i < reverse.end(v); ++i) {
+            uint32_t w = reverse.neighbor(i);
+            if (isFree(w) &&
+                color[w].load(std::memory_order_relaxed) == root &&
+                claim(w, root)) {
+              stack.push_back(w);
+            }
+          }
+        }
+      }, 1);
+
+      rest.erase(std::remove_if(rest.begin(), rest.end(),
+                                [&](uint32_t v) { return !isFree(v); }),
+                 rest.end());
+    }
+  }
+
+  /**
+   * @brief Переводит представителей в плотные номера компонент.
+   */
+  void relabel() {
+    std::vector<uint32_t> dense(n, kNone);
+    component.resize(n);
+    for (size_t v = 0; v < n; ++v) {
+      uint32_t r = owner[v].load(std::memory_order_relaxed);
+      if (dense[r] == kNone) dense[r] = static_cast<uint32_t>(count++);
+      component[v] = dense[r];
+    }
+  }
+};
+
+}  // namespace graph
+
+#endif  // PARALLEL_STRONGLY_CONNECTED_COMPONENTS_H
@@ -0,0 +1,132 @@
+#ifndef PARALLEL_TOPOLOGICAL_SORT_H
+#define PARALLEL_TOPOLOGICAL_SORT_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "../parallel/ParallelFor.h"
+#include "AdjacencyView.h"
+
+namespace graph {
+
+/**
+ * @class ParallelTopologicalSort
+ * @brief Многопоточная топологическая сортировка по уровням.
+ *
+ * Вариант алгоритма Кана, в котором снимается сразу весь фронт: уровень 0 —
+ * вершины без входящих рёбер, уровень k + 1 — вершины, последний
+ * предшественник которых лежит на уровне k. Вершины уровня раскрываются
+ * параллельно, входящие степени уменьшаются атомарно, а следующий уровень
+ * собирается из списков потоков. Вершины одного уровня не связаны рёбрами,
+ * так что их можно обрабатывать одновременно; число уровней — длина
+ * самого длинного пути в вершинах.
+ *
+ * Внутри уровня вершины упорядочены по индексу, поэтому результат не
+ * зависит от числа потоков.
+ *
+ * @tparam VertexType Тип вершины.
+ */
+template <typename VertexType = Vertex>
+class ParallelTopologicalSort {
+ public:
+  static constexpr uint32_t kNone = static_cast<uint32_t>(-1);  ///< Нет.
+
+  /**
+   * @brief Раскладывает вершины графа по уровням.
+   *
+   * @param view Представление графа.
+   * @param threadCount Число потоков.
+   */
+  explicit ParallelTopologicalSort(const AdjacencyView<VertexType>& view,
+                                   size_t threadCount = defaultThreadCount())
+      : level(view.vertexCount(), kNone) {
+    const size_t n = view.vertexCount();
+    WorkerTeam team(threadCount);
+    std::vector<std::atomic<uint32_t>> inDegree(n);
+    team.forEach(0, n, [&](size_t v, size_t) {
+      inDegree[v].store(0, std::memory_order_relaxed);
+    }, kGrain);
+    team.forEach(0, n, [&](size_t u, size_t) {
+      for (size_t i = view.begin(u); i < view.end(u); ++i) {
+        inDegree[view.neighbor(i)].fetch_add(1, std::memory_order_relaxed);
+      }
+    }, kGrain);
+
+    std::vector<uint32_t> frontier;
+    for (uint32_t v = 0; v < n; ++v) {
+      if (inDegree[v].load(std::memory_order_relaxed) == 0) {
+        frontier.push_back(v);
+      }
+    }
+    std::vector<std::vector<uint32_t>> localLists(team.size());
+    order.reserve(n);
+    while (!frontier.empty()) {
+      const uint32_t depth = static_cast<uint32_t>(offsets.size());
+      offsets.push_back(order.size());
+      for (uint32_t v : frontier) {
+        level[v] = depth;
+      }
+      order.insert(order.end(), frontier.begin(), frontier.end());
+
+      advanceFrontier(
+          team, frontier, localLists,
+          [&](uint32_t u, size_t worker) {
+            for (size_t i = view.begin(u); i < view.end(u); ++i) {
+              const uint32_t w = view.neighbor(i);
+              if (inDegree[w].fetch_sub(1, std::memory_order_relaxed) == 1) {
+                localLists[worker].push_back(w);
+              }
+            }
+          },
+          kGrain);
+      std::sort(frontier.begin(), frontier.end());
+    }
+    offsets.push_back(order.size());
+  }
+
+  /**
+   * @brief Проверяет, что граф ациклический.
+   */
+  bool isAcyclic() const { return order.size() == level.size(); }
+
+  /**
+   * @brief Возвращает индексы вершин в топологическом порядке по уровням.
+   *
+   * Для графа с циклом содержит только вершины, не достижимые из циклов.
+   */
+  const std::vector<uint32_t>& getOrder() const { return order; }
+
+  /**
+   * @brief Возвращает число уровней.
+   */
+  size_t levelCount() const { return offsets.size() - 1; }
+
+  /**
+   * @brief Возвращает начало уровня в getOrder().
+   */
+  size_t levelBegin(size_t k) const { return offsets[k]; }
+
+  /**
+   * @brief Возвращает конец уровня в getOrder().
+   */
+  size_t levelEnd(size_t k) const { return offsets[k + 1]; }
+
+  /**
+   * @brief Возвращает уровень вершины по её индексу или kNone для вершин,
+   * не попавших в порядок из-за цикла.
+   */
+  uint32_t getLevel(size_t v) const { return level[v]; }
+
+ private:
+  static constexpr size_t kGrain = 256;  ///< Блок вершин для потока.
+
+  std::vector<uint32_t> level;   ///< Уровни вершин.
+  std::vector<uint32_t> order;   ///< Вершины по уровням.
+  std::vector<size_t> offsets;   ///< Начало каждого уровня в order.
+};
+
+}  // namespace graph
+
+#endif  // PARALLEL_TOPOLOGICAL_SORT_H
@@ -0,0 +1,235 @@
+#ifndef STRONGLY_CONNECTED_COMPONENTS_H
+#define STRONGLY_CONNECTED_COMPONENTS_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "AdjacencyView.h"
+
+namespace graph {
+
+/**
+ * @class StronglyConnectedComponents
+ * @brief Компоненты сильной связности ориентированного графа.
+ *
+ * Используется итеративный вариант алгоритма Тарьяна по Пирсу (Pearce,
+ * "A space-efficient algorithm for finding strongly connected components"):
+ * вместо номеров и low-link хранится один массив rindex, а признак корня
+ * лежит в кадре явного стека вызовов, поэтому рекурсии нет и на вершину
+ * приходится одно 32-битное слово плюс место в стеках.
+ *
+ * Номера компонент идут в топологическом порядке графа конденсации: ребро
+ * между разными компонентами всегда ведёт из меньшего номера в больший.
+ *
+ * @tparam VertexType Тип вершины.
+ */
+template <typename VertexType = Vertex>
+class StronglyConnectedComponents {
+ public:
+  /**
+   * @brief Находит компоненты сильной связности.
+   * @param view Представление графа; должно жить дольше объекта.
+   */
+  explicit StronglyConnectedComponents(const AdjacencyView<VertexType>& view)
+      : view(view) {
+    findComponents();
+    groupVertices();
+  }
+
+  /**
+   * @brief Возвращает число компонент.
+   */
+  size_t componentCount() const { return offsets.size() - 1; }
+
+  /**
+   * @brief Возвращает номера компонент по индексам вершин представления.
+   */
+  const std::vector<uint32_t>& getComponents() const { return component; }
+
+  /**
+   * @brief Возвращает номер компоненты вершины по её индексу.
+   */
+  uint32_t getComponent(size_t v) const { return component[v]; }
+
+  /**
+   * @brief Возвращает размер компоненты.
+   */
+  size_t getComponentSize(size_t c) const {
+    return offsets[c + 1] - offsets[c];
+  }
+
+  /**
+   * @brief Возвращает вершины компоненты.
+   */
+  std::vector<VertexType> getComponentVertices(size_t c) const {
+    std::vector<VertexType> result;
+    result.reserve(getComponentSize(c));
+    for (size_t i = offsets[c]; i < offsets[c + 1]; ++i) {
+      result.push_back(view.getVertex(members[i]));
+    }
+    return result;
+  }
+
+  /**
+   * @brief Проверяет, есть ли в графе цикл.
+   *
+   * Цикл есть, если какая-то компонента содержит больше одной вершины или
+   * вершина имеет петлю.
+   */
+  bool hasCycle() const {
+    if (componentCount() < view.vertexCount()) return true;
+    for (size_t u = 0; u < view.vertexCount(); ++u) {
+      for (size_t i = view.begin(u); i < view.end(u); ++i) {
+        if (view.neighbor(i) == u) return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Строит граф конденсации.
+   *
+   * Вершина Vertex(c) соответствует компоненте c; между компонентами
+   * остаётся не более одного ребра, петли отбрасываются.
+   *
+   * @return Ациклический граф компонент.
+   */
+  AdjacencyView<Vertex> getCondensation() const {
+    const size_t count = componentCount();
+    std::vector<Vertex> vertices;
+    vertices.reserve(count);
+    for (size_t c = 0; c < count; ++c) {
+      vertices.emplace_back(static_cast<int>(c));
+    }
+
+    // Повторные рёбра отсекаются отметкой последней компоненты-источника
+    constexpr uint32_t kUnmarked = static_cast<uint32_t>(-1);
+    std::vector<uint32_t> lastSource(count, kUnmarked);
+    std::vector<std::pair<uint32_t, uint32_t>> edges;
+    for (uint32_t c = 0; c < count; ++c) {
+      for (size_t i = offsets[c]; i < offsets[c + 1]; ++i) {
+        const uint32_t u = members[i];
+        for (size_t j = view.begin(u); j < view.end(u); ++j) {
+          const uint32_t d = component[view.neighbor(j)];
+          if (d != c && lastSource[d] != c) {
+            lastSource[d] = c;
+            edges.emplace_back(c, d);
+          }
+        }
+      }
+    }
+    return AdjacencyView<Vertex>(std::move(vertices), edges);
+  }
+
+ private:
+  /**
+   * @brief Кадр стека вызовов.
+   */
+  struct Frame {
+    uint32_t vertex;  ///< Индекс вершины.
+    bool root;        ///< Вершина пока остаётся корнем компоненты.
+    size_t cursor;    ///< Позиция текущего ребра в массиве смежности.
+  };
+
+  const AdjacencyView<VertexType>& view;  ///< Представление графа.
+  std::vector<uint32_t> component;  ///< Номер компоненты каждой вершины.
+  std::vector<size_t> offsets;      ///< Начало вершин каждой компоненты.
+  std::vector<uint32_t> members;    ///< Вершины по компонентам.
+
+  /**
+   * @brief Алгоритм Пирса без рекурсии.
+   *
+   * rindex[v] == 0 — вершина не посещена; активные вершины получают номера
+   * с единицы, а завершённые — номер компоненты c, отсчитываемый от n вниз,
+   * так что он всегда больше номера любой активной вершины.
+   */
+  void findComponents() {
+    const size_t n = view.vertexCount();
+    std::vector<uint32_t>& rindex = component;
+    rindex.assign(n, 0);
+    std::vector<Frame> calls;
+    std::vector<uint32_t> stack;
+    uint32_t index = 1;
+    uint32_t c = static_cast<uint32_t>(n);
+
+    for (size_t start = 0; start < n; ++start) {
+      if (rindex[start] != 0) continue;
+      rindex[start] = index++;
+      calls.push_back(
+          Frame{static_cast<uint32_t>(start), true, view.begin(start)});
+
+      while (!calls.empty()) {
+        Frame& frame = calls.back();
+        const uint32_t v = frame.vertex;
+        if (frame.cursor < view.end(v)) {
+          const uint32_t w = view.neighbor(frame.cursor);
+          if (rindex[w] == 0) {
+            // Ребро будет дообработано после возврата из w
+            rindex[w] = index++;
+            calls.push_back(Frame{w, true, view.begin(w)});
+            continue;
+          }
+          if (rindex[w] < rindex[v]) {
+            rindex[v] = rindex[w];
+            frame.root = false;
+          }
+          ++frame.cursor;
+          continue;
+        }
+
+        const bool root = frame.root;
+        calls.pop_back();
+        if (root) {
+          --index;
+          --c;
+          while (!stack.empty() && rindex[v] <= rindex[stack.back()]) {
+            rindex[stack.back()] = c;
+            stack.pop_back();
+            --index;
+          }
+          rindex[v] = c;
+        } else {
+          stack.push_back(v);
+        }
+        if (!calls.empty()) {
+          // Возврат в родителя: учитываем ребро в v
+          Frame& parent = calls.back();
+          if (rindex[v] < rindex[parent.vertex]) {
+            rindex[parent.vertex] = rindex[v];
+            parent.root = false;
+          }
+          ++parent.cursor;
+        }
+      }
+    }
+
+    // Первой завершается компонента-сток, она получила наибольший номер
+    for (uint32_t& r : rindex) {
+      r -= c;
+    }
+    offsets.assign(n - c + 1, 0);
+  }
+
+  /**
+   * @brief Группирует вершины по компонентам подсчётом.
+   */
+  void groupVertices() {
+    const size_t count = offsets.size() - 1;
+    for (uint32_t comp : component) {
+      ++offsets[comp + 1];
+    }
+    for (size_t k = 0; k < count; ++k) {
+      offsets[k + 1] += offsets[k];
+    }
+    members.resize(component.size());
+    std::vector<size_t> cursor(offsets.begin(), offsets.end() - 1);
+    for (size_t v = 0; v < component.size(); ++v) {
+      members[cursor[component[v]]++] = static_cast<uint32_t>(v);
+    }
+  }
+};
+
+}  // namespace graph
+
+#endif  // STRONGLY_CONNECTED_COMPONENTS_H
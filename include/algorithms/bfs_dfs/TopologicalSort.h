@@ -0,0 +1,153 @@
+#ifndef TOPOLOGICAL_SORT_H
+#define TOPOLOGICAL_SORT_H
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "AdjacencyView.h"
+#include "Graph.h"
+
+namespace graph {
+
+/**
+ * @class TopologicalSort
+ * @brief Топологическая сортировка ориентированного графа алгоритмом Кана.
+ *
+ * Входящие степени считаются одним проходом по массиву смежности, затем
+ * вершины с нулевой степенью снимаются очередью, уменьшая степени соседей.
+ * Очередь — это сам массив порядка, так что дополнительной памяти, кроме
+ * степеней, не требуется. Если сняты не все вершины, в графе есть цикл:
+ * оставшиеся вершины доступны через getCyclicVertices(), а один конкретный
+ * цикл — через findCycle().
+ *
+ * @tparam VertexType Тип вершины.
+ */
+template <typename VertexType = Vertex>
+class TopologicalSort {
+ public:
+  /**
+   * @brief Сортирует вершины графа.
+   * @param view Представление графа; должно жить дольше объекта.
+   */
+  explicit TopologicalSort(const AdjacencyView<VertexType>& view)
+      : view(view) {
+    const size_t n = view.vertexCount();
+    inDegree.assign(n, 0);
+    for (size_t i = 0; i < view.edgeCount(); ++i) {
+      ++inDegree[view.neighbor(i)];
+    }
+    order.reserve(n);
+    for (size_t v = 0; v < n; ++v) {
+      if (inDegree[v] == 0) order.push_back(static_cast<uint32_t>(v));
+    }
+    for (size_t head = 0; head < order.size(); ++head) {
+      const uint32_t u = order[head];
+      for (size_t i = view.begin(u); i < view.end(u); ++i) {
+        const uint32_t w = view.neighbor(i);
+        if (--inDegree[w] == 0) order.push_back(w);
+      }
+    }
+  }
+
+  /**
+   * @brief Проверяет, что граф ациклический.
+   */
+  bool isAcyclic() const { return order.size() == view.vertexCount(); }
+
+  /**
+   * @brief Возвращает индексы вершин в топологическом порядке.
+   *
+   * Для графа с циклом содержит только вершины, не достижимые из циклов.
+   */
+  const std::vector<uint32_t>& getOrder() const { return order; }
+
+  /**
+   * @brief Возвращает вершины в топологическом порядке.
+   * @throws std::invalid_argument Если в графе есть цикл.
+   */
+  std::vector<VertexType> getSortedVertices() const {
+    if (!isAcyclic()) {
+      throw std::invalid_argument("Graph contains a cycle");
+    }
+    std::vector<VertexType> result;
+    result.reserve(order.size());
+    for (uint32_t v : order) {
+      result.push_back(view.getVertex(v));
+    }
+    return result;
+  }
+
+  /**
+   * @brief Возвращает индексы вершин, не попавших в порядок.
+   *
+   * Это вершины циклов и всё, что достижимо из них.
+   */
+  std::vector<uint32_t> getCyclicVertices() const {
+    std::vector<uint32_t> result;
+    for (size_t v = 0; v < inDegree.size(); ++v) {
+      if (inDegree[v] != 0) result.push_back(static_cast<uint32_t>(v));
+    }
+    return result;
+  }
+
+  /**
+   * @brief Находит один цикл графа.
+   *
+   * У каждой оставшейся вершины есть оставшийся предшественник, поэтому
+   * шаги назад по транспонированному графу рано или поздно замыкаются.
+   *
+   * @return Индексы вершин цикла в порядке рёбер; пусто для ациклического
+   * графа.
+   */
+  std::vector<uint32_t> findCycle() const {
+    if (isAcyclic()) return {};
+    const AdjacencyView<VertexType> reverse = view.transpose();
+    constexpr uint32_t kUnvisited = static_cast<uint32_t>(-1);
+    std::vector<uint32_t> step(view.vertexCount(), kUnvisited);
+    std::vector<uint32_t> walk;
+    uint32_t v = getCyclicVertices().front();
+    while (step[v] == kUnvisited) {
+      step[v] = static_cast<uint32_t>(walk.size());
+      walk.push_back(v);
+      for (size_t i = reverse.begin(v); i < reverse.end(v); ++i) {
+        const uint32_t p = reverse.neighbor(i);
+        if (inDegree[p] != 0) {
+          v = p;
+          break;
+        }
+      }
+    }
+    // Путь шёл против рёбер: разворачиваем замкнувшийся участок
+    std::vector<uint32_t> cycle(walk.begin() + step[v], walk.end());
+    std::reverse(cycle.begin(), cycle.end());
+    return cycle;
+  }
+
+ private:
+  const AdjacencyView<VertexType>& view;  ///< Представление графа.
+  /// Входящие степени; после сортировки ненулевые только у вершин с циклами.
+  std::vector<uint32_t> inDegree;
+  std::vector<uint32_t> order;  ///< Топологический порядок.
+};
+
+/**
+ * @brief Топологическая сортировка графа.
+ *
+ * @tparam VertexType Тип вершины.
+ * @tparam EdgeType Тип ребра.
+ * @param graph Ориентированный граф.
+ * @return Вершины в порядке, где каждое ребро ведёт вперёд.
+ * @throws std::invalid_argument Если в графе есть цикл.
+ */
+template <typename VertexType, typename EdgeType>
+std::vector<VertexType> topologicalSort(
+    const Graph<VertexType, EdgeType>& graph) {
+  AdjacencyView<VertexType> view(graph);
+  return TopologicalSort<VertexType>(view).getSortedVertices();
+}
+
+}  // namespace graph
+
+#endif  // TOPOLOGICAL_SORT_H
@@ -0,0 +1,125 @@
+#ifndef TRIANGLE_COUNTING_H
+#define TRIANGLE_COUNTING_H
+
+#include <cstdint>
+#include <vector>
+
+#include "../parallel/ParallelFor.h"
+#include "AdjacencyMatrixGraph.h"
+
+namespace graph {
+
+/**
+ * @brief Результат подсчёта треугольников и коэффициентов кластеризации.
+ * @tparam VertexType Тип вершины.
+ */
+template <typename VertexType>
+struct TriangleCountResult {
+  std::vector<VertexType> vertices;  ///< Вершины в порядке индексов матрицы.
+  std::vector<size_t> triangles;  ///< Число треугольников, содержащих вершину.
+  std::vector<double> localClustering;  ///< Локальные коэффициенты.
+  size_t totalTriangles = 0;     ///< Общее число треугольников в графе.
+  double globalClustering = 0;   ///< Транзитивность графа.
+  double averageClustering = 0;  ///< Средний локальный коэффициент.
+};
+
+/**
+ * @brief Подсчёт треугольников и коэффициентов кластеризации по матрице
+ * смежности.
+ *
+ * Граф рассматривается как неориентированный: вершины смежны, если есть ребро
+ * хотя бы в одном направлении, петли игнорируются. Для каждой вершины v число
+ * треугольников равно половине суммы |N(v) ∩ N(u)| по соседям u, а каждое
+ * пересечение считается как popcount от побитового И упакованных строк.
+ * Строки обрабатываются параллельно и независимо друг от друга.
+ *
+ * @tparam VertexType Тип вершины.
+ * @tparam EdgeType Тип ребра.
+ * @param graph Граф на основе матрицы смежности.
+ * @param threadCount Число потоков.
+ * @return Статистика треугольников по вершинам и по графу в целом.
+ */
+template <typename VertexType, typename EdgeType>
+TriangleCountResult<VertexType> countTriangles(
+    const AdjacencyMatrixGraph<VertexType, EdgeType>& graph,
+    size_t threadCount = defaultThreadCount()) {
+  constexpr size_t kWordBits = 64;
+  const size_t n = graph.getMatrixSize();
+  const size_t words = (n + kWordBits - 1) / kWordBits;
+
+  TriangleCountResult<VertexType> result;
+  result.vertices.reserve(n);
+  for (size_t i = 0; i < n; ++i) {
+    result.vertices.push_back(graph.getVertexByIndex(i));
+  }
+  result.triangles.assign(n, 0);
+  result.localClustering.assign(n, 0.0);
+  if (n == 0) return result;
+
+  // Симметризуем матрицу в одном непрерывном массиве: A | A^T без диагонали.
+  std::vector<uint64_t> rows(n * words, 0);
+  for (size_t i = 0; i < n; ++i) {
+    const auto& source = graph.getAdjacencyRow(i);
+    uint64_t* row = rows.data() + i * words;
+    for (size_t w = 0; w < words; ++w) {
+      row[w] |= source[w];
+      for (uint64_t bits = source[w]; bits != 0; bits &= bits - 1) {
+        size_t j = w * kWordBits + __builtin_ctzll(bits);
+        rows[j * words + i / kWordBits] |= uint64_t{1} << (i % kWordBits);
+      }
+    }
+  }
+  for (size_t i = 0; i < n; ++i) {
+    rows[i * words + i / kWordBits] &= ~(uint64_t{1} << (i % kWordBits));
+  }
+
+  std::vector<size_t> degree(n, 0);
+  parallelFor(0, n, threadCount, [&](size_t i) {
+    const uint64_t* row = rows.data() + i * words;
+    size_t d = 0;
+    for (size_t w = 0; w < words; ++w) {
+      d += __builtin_popcountll(row[w]);
+    }
+    degree[i] = d;
+
+    // Каждый треугольник (i, j, k) учитывается дважды: через j и через k.
+    size_t common = 0;
+    for (size_t w = 0; w < words; ++w) {
+      for (uint64_t bits = row[w]; bits != 0; bits &= bits - 1) {
+        size_t j = w * kWordBits + __builtin_ctzll(bits);
+        const uint64_t* other = rows.data() + j * words;
+        for (size_t k = 0; k < words; ++k) {
+          common += __builtin_popcountll(row[k] & other[k]);
+        }
+      }
+    }
+    result.triangles[i] = common / 2;
+    if (d >= 2) {
+      result.localClustering[i] =
+          2.0 * static_cast<double>(result.triangles[i]) /
+          (static_cast<double>(d) * static_cast<double>(d - 1));
+    }
+  });
+
+  size_t triangleSum = 0;
+  double wedges = 0;
+  double clusteringSum = 0;
+  for (size_t i = 0; i < n; ++i) {
+    triangleSum += result.triangles[i];
+    if (degree[i] >= 2) {
+      wedges += static_cast<double>(degree[i]) *
+                static_cast<double>(degree[i] - 1) / 2.0;
+    }
+    clusteringSum += result.localClustering[i];
+  }
+  result.totalTriangles = triangleSum / 3;
+  if (wedges > 0) {
+    result.globalClustering = static_cast<double>(triangleSum) / wedges;
+  }
+  result.averageClustering = clusteringSum / static_cast<double>(n);
+  return result;
+}
+
+}  // namespace graph
+
+#endif  // TRIANGLE_COUNTING_H
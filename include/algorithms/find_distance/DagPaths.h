@@ -0,0 +1,240 @@
+#ifndef DAG_PATHS_H
+#define DAG_PATHS_H
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "AdjacencyView.h"
+#include "Graph.h"
+#include "TopologicalSort.h"
+
+namespace graph {
+
+/**
+ * @brief Вид путей, которые ищет DagPaths.
+ */
+enum class DagPathKind {
+  Shortest,  ///< Кратчайшие пути.
+  Longest    ///< Длиннейшие (критические) пути.
+};
+
+/**
+ * @class DagPaths
+ * @brief Кратчайшие и длиннейшие пути в ациклическом графе.
+ *
+ * Вершины один раз сортируются топологически (TopologicalSort), после чего
+ * каждый поиск релаксирует рёбра в этом порядке: к моменту обработки
+ * вершины все пути в неё уже учтены. Поиск занимает O(V + E) без очереди с
+ * приоритетами, допускает отрицательные веса и одинаково находит как
+ * кратчайшие, так и длиннейшие пути — на графах с циклами последняя задача
+ * не решается за полиномиальное время.
+ *
+ * @tparam VertexType Тип вершины.
+ * @tparam WeightType Тип веса ребра.
+ */
+template <typename VertexType = Vertex, typename WeightType = int>
+class DagPaths {
+ public:
+  static constexpr uint32_t kNone = static_cast<uint32_t>(-1);  ///< Нет.
+
+  /**
+   * @brief Подготавливает поиск путей во взвешенном графе.
+   *
+   * @param graph Ориентированный взвешенный граф.
+   * @param kind Искать кратчайшие или длиннейшие пути.
+   * @throws std::invalid_argument Если в графе есть цикл.
+   */
+  explicit DagPaths(const Graph<VertexType, WeightedEdge<WeightType>>& graph,
+                    DagPathKind kind = DagPathKind::Shortest)
+      : view(graph),
+        weights(view.edgeValues(
+            graph, [](const WeightedEdge<WeightType>& e) { return e.weight; })),
+        kind(kind) {
+    sortVertices();
+    reset();
+  }
+
+  /**
+   * @brief Подготавливает поиск путей по готовому представлению графа.
+   *
+   * @param view Представление графа.
+   * @param weights Веса рёбер по позициям в массиве смежности.
+   * @param kind Искать кратчайшие или длиннейшие пути.
+   * @throws std::invalid_argument Если число весов не совпадает с числом
+   * рёбер или в графе есть цикл.
+   */
+  DagPaths(AdjacencyView<VertexType> view, std::vector<WeightType> weights,
+           DagPathKind kind = DagPathKind::Shortest)
+      : view(std::move(view)), weights(std::move(weights)), kind(kind) {
+    if (this->weights.size() != this->view.edgeCount()) {
+      throw std::invalid_argument("Weights do not match edges");
+    }
+    sortVertices();
+    reset();
+  }
+
+  /**
+   * @brief Ищет пути из одной вершины.
+   * @param start Начальная вершина.
+   * @throws std::out_of_range Если вершины нет в графе.
+   */
+  void solve(const VertexType& start) {
+    const size_t s = view.getIndex(start);
+    reset();
+    reached[s] = 1;
+    distance[s] = WeightType{};
+    relax();
+  }
+
+  /**
+   * @brief Ищет пути, начинающиеся в любой вершине.
+   *
+   * Каждая вершина служит началом пути нулевой длины. Для длиннейших путей
+   * это даёт критический путь: getDistances() содержит самое позднее
+   * завершение пути в каждой вершине.
+   */
+  void solveFromAll() {
+    reset();
+    std::fill(reached.begin(), reached.end(), 1);
+    std::fill(distance.begin(), distance.end(), WeightType{});
+    relax();
+  }
+
+  /**
+   * @brief Проверяет, достигнута ли вершина последним поиском.
+   *
+   * До первого поиска все вершины считаются недостижимыми.
+   *
+   * @throws std::out_of_range Если вершины нет в графе.
+   */
+  bool isReachable(const VertexType& v) const {
+    return reached[view.getIndex(v)];
+  }
+
+  /**
+   * @brief Возвращает длину найденного пути до вершины.
+   *
+   * @param v Вершина.
+   * @return Длина пути; для недостижимой вершины —
+   * std::numeric_limits<WeightType>::max() при поиске кратчайших путей и
+   * lowest() при поиске длиннейших.
+   * @throws std::out_of_range Если вершины нет в графе.
+   */
+  WeightType getDistance(const VertexType& v) const {
+    return distance[view.getIndex(v)];
+  }
+
+  /**
+   * @brief Возвращает длины путей по индексам вершин представления.
+   */
+  const std::vector<WeightType>& getDistances() const { return distance; }
+
+  /**
+   * @brief Восстанавливает найденный путь до вершины.
+   *
+   * @param target Конечная вершина.
+   * @return Вершины пути от начала до target; пусто, если она недостижима.
+   * @throws std::out_of_range Если вершины нет в графе.
+   */
+  std::vector<VertexType> getPath(const VertexType& target) const {
+    uint32_t v = static_cast<uint32_t>(view.getIndex(target));
+    if (!reached[v]) return {};
+    std::vector<VertexType> path;
+    for (; v != kNone; v = predecessor[v]) {
+      path.push_back(view.getVertex(v));
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+  }
+
+  /**
+   * @brief Возвращает представление графа.
+   */
+  const AdjacencyView<VertexType>& getView() const { return view; }
+
+ private:
+  AdjacencyView<VertexType> view;    ///< Представление графа.
+  std::vector<WeightType> weights;   ///< Веса рёбер по позициям.
+  DagPathKind kind;                  ///< Вид путей.
+  std::vector<uint32_t> order;       ///< Топологический порядок.
+  std::vector<WeightType> distance;  ///< Длины путей.
+  std::vector<uint32_t> predecessor;  ///< Предыдущая вершина пути.
+  std::vector<char> reached;          ///< Вершина достигнута.
+
+  /**
+   * @brief Сортирует вершины топологически.
+   * @throws std::invalid_argument Если в графе есть цикл.
+   */
+  void sortVertices() {
+    TopologicalSort<VertexType> sort(view);
+    if (!sort.isAcyclic()) {
+      throw std::invalid_argument("Graph contains a cycle");
+    }
+    order = sort.getOrder();
+  }
+
+  /**
+   * @brief Сбрасывает результаты предыдущего поиска.
+   */
+  void reset() {
+    const size_t n = view.vertexCount();
+    using Limits = std::numeric_limits<WeightType>;
+    const WeightType unreached =
+        kind == DagPathKind::Shortest ? Limits::max() : Limits::lowest();
+    distance.assign(n, unreached);
+    predecessor.assign(n, kNone);
+    reached.assign(n, 0);
+  }
+
+  /**
+   * @brief Релаксирует рёбра в топологическом порядке.
+   */
+  void relax() {
+    const bool shortest = kind == DagPathKind::Shortest;
+    for (uint32_t u : order) {
+      if (!reached[u]) continue;
+      for (size_t i = view.begin(u); i < view.end(u); ++i) {
+        const uint32_t w = view.neighbor(i);
+        const WeightType candidate = distance[u] + weights[i];
+        const bool better = shortest ? candidate < distance[w]
+                                     : candidate > distance[w];
+        if (!reached[w] || better) {
+          reached[w] = 1;
+          distance[w] = candidate;
+          predecessor[w] = u;
+        }
+      }
+    }
+  }
+};
+
+/**
+ * @brief Находит критический (длиннейший) путь ациклического графа.
+ *
+ * @tparam VertexType Тип вершины.
+ * @tparam WeightType Тип веса ребра.
+ * @param graph Ориентированный взвешенный граф.
+ * @return Длина критического пути и его вершины; для пустого графа — ноль и
+ * пустой путь.
+ * @throws std::invalid_argument Если в графе есть цикл.
+ */
+template <typename VertexType, typename WeightType>
+std::pair<WeightType, std::vector<VertexType>> criticalPath(
+    const Graph<VertexType, WeightedEdge<WeightType>>& graph) {
+  DagPaths<VertexType, WeightType> paths(graph, DagPathKind::Longest);
+  paths.solveFromAll();
+  const auto& distances = paths.getDistances();
+  if (distances.empty()) return {WeightType{}, {}};
+  size_t best = std::max_element(distances.begin(), distances.end()) -
+                distances.begin();
+  const VertexType& target = paths.getView().getVertex(best);
+  return {distances[best], paths.getPath(target)};
+}
+
+}  // namespace graph
+
+#endif  // DAG_PATHS_H
@@ -1,9 +1,10 @@
 #ifndef DINIC_H
 #define DINIC_H
 
-#include <climits>
-#include <queue>
-#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
 
 #include "FlowNetwork.h"
 
@@ -16,9 +17,13 @@ namespace graph {
  *
  * Этот класс реализует алгоритм Диница для нахождения максимального потока в
  * сети. Алгоритм использует построение слоистых сетей и поиск блокирующего
- * потока.
+ * потока. Уровни и текущие дуги хранятся в плотных массивах по индексам
+ * вершин, а блокирующий поток ищется без рекурсии.
+ *
+ * @tparam GraphType Тип базового графа.
+ * @tparam Capacity Тип пропускных способностей.
  */
-template <typename GraphType>
+template <typename GraphType, typename Capacity = int>
 class DinicSolver {
  public:
   /**
@@ -26,7 +31,8 @@ class DinicSolver {
    *
    * @param network Сеть, для которой будет вычисляться максимальный поток.
    */
-  explicit DinicSolver(FlowNetwork<GraphType>& network) : network(network) {}
+  explicit DinicSolver(FlowNetwork<GraphType, Capacity>& network)
+      : network(network) {}
 
   /**
    * @brief Вычисляет максимальный поток в сети.
@@ -35,92 +41,123 @@ class DinicSolver {
    * @param sink Сток (конечная вершина).
    * @return Значение максимального потока.
    */
-  int computeMaxFlow(const Vertex& source, const Vertex& sink) {
-    this->source = source;
-    this->sink = sink;
+  Capacity computeMaxFlow(const Vertex& source, const Vertex& sink) {
+    network.buildArcIndex();
+    size_t s = network.getVertexIndex(source);
+    size_t t = network.getVertexIndex(sink);
+    if (s == t) return 0;
 
-    int maxFlow = 0;
-    while (buildLevelGraph(source, sink)) {
+    // Допустимый поток, уже лежащий в сети, служит начальным
+    Capacity maxFlow = network.prepareFlow(s, t);
+    while (buildLevelGraph(s, t)) {
       initializePtr();
-      while (int flow = findBlockingFlow(source, sink)) {
-        maxFlow += flow;
-      }
+      maxFlow += findBlockingFlow(s, t);
     }
     return maxFlow;
   }
 
  private:
-  FlowNetwork<GraphType>& network;  ///< Сеть, для которой вычисляется поток.
-  std::unordered_map<Vertex, int> level;  ///< Уровни вершин в слоистой сети.
-  std::unordered_map<Vertex, size_t>
-      ptr;  ///< Указатели для поиска блокирующего потока.
-  Vertex source;  ///< Исток (начальная вершина).
-  Vertex sink;    ///< Сток (конечная вершина).
+  FlowNetwork<GraphType, Capacity>&
+      network;             ///< Сеть, для которой вычисляется поток.
+  std::vector<int> level;  ///< Уровни вершин в слоистой сети.
+  std::vector<size_t> ptr;  ///< Текущие дуги для поиска блокирующего потока.
+  std::vector<size_t> queue;  ///< Очередь BFS.
+  std::vector<uint32_t> path;  ///< Стек рёбер текущего пути от истока.
 
   /**
    * @brief Строит слоистую сеть.
    *
-   * @param source Исток (начальная вершина).
-   * @param sink Сток (конечная вершина).
+   * @param source Индекс истока.
+   * @param sink Индекс стока.
    * @return true, если сток достижим из истока, иначе false.
    */
-  bool buildLevelGraph(const Vertex& source, const Vertex& sink) {
-    level.clear();
-    std::queue<Vertex> q;
-    q.push(source);
+  bool buildLevelGraph(size_t source, size_t sink) {
+    level.assign(network.vertexCount(), -1);
+    queue.clear();
+    queue.push_back(source);
     level[source] = 0;
 
-    while (!q.empty()) {
-      auto u = q.front();
-      q.pop();
-
-      for (const auto& e : network.getAdjacent(u)) {
-        if (!level.count(e.target) && e.flow < e.capacity) {
+    for (size_t head = 0; head < queue.size(); ++head) {
+      size_t u = queue[head];
+      // Вершины не ближе стока не лежат на кратчайших путях
+      if (level[sink] >= 0 && level[u] >= level[sink]) break;
+      for (uint32_t id : network.getArcs(u)) {
+        const auto& e = network.getEdge(id);
+        if (level[e.target] < 0 && e.hasResidual()) {
           level[e.target] = level[u] + 1;
-          q.push(e.target);
+          queue.push_back(e.target);
         }
       }
     }
-    return level.count(sink);
+    return level[sink] >= 0;
   }
 
   /**
-   * @brief Инициализирует указатели для поиска блокирующего потока.
+   * @brief Инициализирует указатели текущих дуг всех вершин.
    */
-  void initializePtr() {
-    ptr.clear();
-    for (const auto& [v, _] : network.getAdjacentMut(source)) {
-      ptr[v] = 0;
-    }
-  }
+  void initializePtr() { ptr.assign(network.vertexCount(), 0); }
 
   /**
    * @brief Находит блокирующий поток в слоистой сети.
    *
-   * @param u Текущая вершина.
-   * @param sink Сток (конечная вершина).
-   * @param minCap Минимальная пропускная способность на пути.
-   * @return Значение найденного потока.
+   * Обход в глубину ведётся явным стеком рёбер текущего пути. Дойдя до стока,
+   * поток проталкивается по всему пути, после чего обход откатывается только
+   * до первого насыщенного ребра и продолжает искать следующие пути оттуда,
+   * так что за один проход находится сразу много увеличивающих путей.
+   *
+   * @param source Индекс истока.
+   * @param sink Индекс стока.
+   * @return Величина найденного блокирующего потока.
    */
-  int findBlockingFlow(const Vertex& u, const Vertex& sink,
-                       int minCap = INT_MAX) {
-    if (u == sink) return minCap;
-    for (size_t& i = ptr[u]; i < network.getAdjacentMut(u).size(); ++i) {
-      auto& e = network.getAdjacentMut(u)[i];
-      if (level[e.target] == level[u] + 1 && e.flow < e.capacity) {
-        int flow = findBlockingFlow(e.target, sink,
-                                    std::min(minCap, e.capacity - e.flow));
-        if (flow > 0) {
-          e.flow += flow;
-          e.reverse->flow -= flow;
-          return flow;
+  Capacity findBlockingFlow(size_t source, size_t sink) {
+    Capacity total = 0;
+    path.clear();
+    size_t u = source;
+    while (true) {
+      if (u == sink) {
+        Capacity flow = std::numeric_limits<Capacity>::max();
+        for (uint32_t id : path) {
+          flow = std::min(flow, network.getEdge(id).residual());
         }
+        size_t saturated = path.size();
+        for (size_t i = 0; i < path.size(); ++i) {
+          network.pushFlow(path[i], flow);
+          if (saturated == path.size() &&
+              !network.getEdge(path[i]).hasResidual()) {
+            saturated = i;
+          }
+        }
+        total += flow;
+        path.resize(saturated);
+        u = path.empty() ? source : network.getEdge(path.back()).target;
+        continue;
       }
+
+      // Ищем допустимую дугу, начиная с текущей
+      auto arcs = network.getArcs(u);
+      size_t& i = ptr[u];
+      while (i < arcs.size()) {
+        const auto& e = network.getEdge(arcs.begin()[i]);
+        if (level[e.target] == level[u] + 1 && e.hasResidual()) break;
+        ++i;
+      }
+      if (i < arcs.size()) {
+        path.push_back(arcs.begin()[i]);
+        u = network.getEdge(path.back()).target;
+        continue;
+      }
+
+      // Тупик: вершина больше не нужна в этой фазе, откатываемся
+      if (u == source) break;
+      level[u] = -1;
+      path.pop_back();
+      u = path.empty() ? source : network.getEdge(path.back()).target;
+      ++ptr[u];
     }
-    return 0;
+    return total;
   }
 };
 
 }  // namespace graph
 
-#endif  // DINIC_H
\ No newline at end of file
+#endif  // DINIC_H
@@ -1,13 +1,11 @@
 #ifndef EDMONDS_KARP_H
 #define EDMONDS_KARP_H
 
+#include <algorithm>
 #include <limits>
-#include <queue>
-#include <unordered_map>
+#include <vector>
 
 #include "FlowNetwork.h"
-#include "../../graph/Graph.h"
-#include "../bfs_dfs/BFS.h"
 
 namespace graph {
 
@@ -19,52 +17,50 @@ namespace graph {
  * Этот класс реализует алгоритм Эдмондса-Карпа, который является реализацией
  * метода Форда-Фалкерсона с использованием BFS для поиска увеличивающих путей в
  * остаточной сети.
+ *
+ * @tparam GraphType Тип базового графа.
+ * @tparam Capacity Тип пропускных способностей.
  */
-template <typename GraphType>
+template <typename GraphType, typename Capacity = int>
 class EdmondsKarp {
  private:
-  // Теперь напрямую указываем, что работаем с FlowNetwork
-  FlowNetwork<GraphType>& network;
+  FlowNetwork<GraphType, Capacity>& network;  ///< Сеть потоков.
+
+  static constexpr size_t kNoEdge =
+      static_cast<size_t>(-1);  ///< Вершина ещё не достигнута.
 
-  // Явно указываем, что используем типы Vertex и Edge
-  std::unordered_map<Vertex, Vertex>
-      parent;  ///< Хранение родительских вершин для восстановления пути.
+  std::vector<size_t>
+      parentEdge;  ///< Ребро, по которому BFS пришёл в вершину.
+  std::vector<size_t> queue;  ///< Очередь BFS.
 
   /**
-   * @brief Модифицированный BFS для поиска кратчайшего пути в остаточной сети.
+   * @brief BFS для поиска кратчайшего пути в остаточной сети.
    *
-   * @param source Исток (начальная вершина).
-   * @param sink Сток (конечная вершина).
+   * Обход останавливается, как только достигнут сток.
+   *
+   * @param source Индекс истока.
+   * @param sink Индекс стока.
    * @return true, если путь от истока к стоку существует, иначе false.
    */
-  bool bfs(const Vertex& source, const Vertex& sink) {
-    struct FlowVisitor : public Visitor<Vertex, Edge> {
-      std::unordered_map<Vertex, Vertex>&
-          parent;  ///< Ссылка на родительские вершины.
-
-      /**
-       * @brief Конструктор для FlowVisitor.
-       *
-       * @param p Ссылка на родительские вершины.
-       */
-      FlowVisitor(std::unordered_map<Vertex, Vertex>& p) : parent(p) {}
-
-      /**
-       * @brief Обработка ребра дерева в BFS.
-       *
-       * @param e Ребро, которое обрабатывается.
-       */
-      void treeEdge(const Edge& e) override { parent[e.target] = e.source; }
-    };
-
-    parent.clear();
-    FlowVisitor visitor(parent);
-
-    // Используем базовый граф из сети потоков
-    GraphType& graph = network.getBaseGraph();
-    std::vector<int> distances = BFS<Vertex, Edge>(graph, source, visitor);
-
-    return parent.find(sink) != parent.end();
+  bool bfs(size_t source, size_t sink) {
+    parentEdge.assign(network.vertexCount(), kNoEdge);
+    queue.clear();
+    queue.push_back(source);
+
+    for (size_t head = 0; head < queue.size(); ++head) {
+      size_t u = queue[head];
+      for (uint32_t id : network.getArcs(u)) {
+        const auto& e = network.getEdge(id);
+        if (e.target == source || parentEdge[e.target] != kNoEdge ||
+            !e.hasResidual()) {
+          continue;
+        }
+        parentEdge[e.target] = id;
+        if (e.target == sink) return true;
+        queue.push_back(e.target);
+      }
+    }
+    return false;
   }
 
  public:
@@ -74,7 +70,7 @@ class EdmondsKarp {
    * @param network Сеть потоков, для которой будет вычисляться максимальный
    * поток.
    */
-  EdmondsKarp(FlowNetwork<GraphType>& network) : network(network) {}
+  EdmondsKarp(FlowNetwork<GraphType, Capacity>& network) : network(network) {}
 
   /**
    * @brief Вычисляет максимальный поток в сети.
@@ -83,28 +79,25 @@ class EdmondsKarp {
    * @param sink Сток (конечная вершина).
    * @return Значение максимального потока.
    */
-  int computeMaxFlow(const Vertex& source, const Vertex& sink) {
-    int max_flow = 0;
-
-    // Получаем базовый граф из сети потоков
-    GraphType& graph = network.getBaseGraph();
-
-    while (bfs(source, sink)) {
+  Capacity computeMaxFlow(const Vertex& source, const Vertex& sink) {
+    network.buildArcIndex();
+    size_t s = network.getVertexIndex(source);
+    size_t t = network.getVertexIndex(sink);
+    if (s == t) return 0;
+
+    // Допустимый поток, уже лежащий в сети, служит начальным
+    Capacity max_flow = network.prepareFlow(s, t);
+    while (bfs(s, t)) {
       // Находим минимальную остаточную пропускную способность
-      int path_flow = std::numeric_limits<int>::max();
-
-      // Проход от стока к истоку
-      for (Vertex v = sink; v != source; v = parent[v]) {
-        Vertex vp(parent[v], v);
-        if (network.hasResidualCapacity(vp)) {
-          path_flow = std::min(path_flow, network.getResidualCapacity(vp));
-        }
+      Capacity path_flow = std::numeric_limits<Capacity>::max();
+      for (size_t v = t; v != s; v = network.getTail(parentEdge[v])) {
+        path_flow =
+            std::min(path_flow, network.getEdge(parentEdge[v]).residual());
       }
 
       // Обновляем потоки
-      for (Vertex v = sink; v != source; v = parent[v]) {
-        Vertex vp(parent[v], v);
-        network.addFlow(vp, path_flow);
+      for (size_t v = t; v != s; v = network.getTail(parentEdge[v])) {
+        network.pushFlow(parentEdge[v], path_flow);
       }
 
       max_flow += path_flow;
@@ -115,4 +108,4 @@ class EdmondsKarp {
 
 }  // namespace graph
 
-#endif  // EDMONDS_KARP_H
\ No newline at end of file
+#endif  // EDMONDS_KARP_H
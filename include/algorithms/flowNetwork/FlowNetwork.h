@@ -1,111 +1,528 @@
 #ifndef FLOW_NETWORK_H
 #define FLOW_NETWORK_H
 
-#include "Graph.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
 #include <unordered_map>
-#include <memory>
+#include <vector>
+
+#include "Graph.h"
 
 namespace graph {
 
+/**
+ * @brief Свойства типа пропускных способностей
+ * @tparam Capacity Тип пропускных способностей и потоков
+ *
+ * @details Для вещественных типов остаточная ёмкость не больше epsilon
+ *          считается нулевой, иначе накопленные ошибки округления порождают
+ *          бесконечные увеличения на исчезающе малую величину. Для целых
+ *          типов сравнение точное. Специализация позволяет задать свой порог.
+ */
+template <typename Capacity>
+struct CapacityTraits {
+  static constexpr Capacity epsilon =
+      std::is_floating_point_v<Capacity> ? Capacity(1e-9)
+                                         : Capacity(0);  ///< Порог нуля
+};
+
 /**
  * @class FlowNetwork
  * @brief Шаблонный класс для представления сети потоков с остаточными ребрами
  * @tparam GraphType Тип базового графа для построения сети потоков
- * 
- * @details Реализует представление графа с помощью списков смежности,
- *          автоматически создавая обратные ребра для работы алгоритмов поиска потока
+ * @tparam Capacity Тип пропускных способностей и потоков (int, int64_t,
+ * double)
+ *
+ * @details Вершины нумеруются плотными индексами 0..n-1. Все рёбра остаточной
+ *          сети лежат в одном массиве парами: ребро i и ребро i ^ 1 взаимно
+ *          обратны, поэтому обратное ребро находится без указателей и не
+ *          теряется при росте массива. Исходящие рёбра вершин собраны в
+ *          CSR-индекс (смещения по вершинам и массив номеров рёбер), который
+ *          перестраивается после добавления рёбер вызовом buildArcIndex().
  */
-template <typename GraphType>
+template <typename GraphType, typename Capacity = int>
 class FlowNetwork {
-public:
+ public:
+  /**
+   * @struct FlowEdge
+   * @brief Ребро остаточной сети
+   */
+  struct FlowEdge {
+    uint32_t target;  ///< Индекс конечной вершины ребра
+    Capacity capacity;  ///< Пропускная способность ребра
+    Capacity flow;      ///< Текущий поток через ребро (flow <= capacity)
+
     /**
-     * @struct FlowEdge
-     * @brief Ребро потока с метаданными для алгоритмов поиска максимального потока
+     * @brief Возвращает остаточную пропускную способность ребра
      */
-    struct FlowEdge {
-        Vertex target;       ///< Целевая вершина ребра
-        int capacity;        ///< Пропускная способность ребра
-        int flow;            ///< Текущий поток через ребро (0 <= flow <= capacity)
-        FlowEdge* reverse;   ///< Указатель на обратное ребро в остаточной сети
-
-        /**
-         * @brief Конструктор ребра потока
-         * @param t Конечная вершина ребра
-         * @param cap Пропускная способность ребра
-         * @param rev Указатель на обратное ребро (по умолчанию nullptr)
-         */
-        FlowEdge(Vertex t, int cap, FlowEdge* rev = nullptr)
-            : target(t), capacity(cap), flow(0), reverse(rev) {}
-    };
+    Capacity residual() const { return capacity - flow; }
 
     /**
-     * @brief Конструктор сети потоков на основе существующего графа
-     * @param baseGraph Исходный граф для преобразования в сеть потоков
-     * 
-     * @note Автоматически добавляет все вершины и ребра из базового графа,
-     *       инициализируя поле capacity значением из исходного ребра
+     * @brief Проверяет, можно ли ещё пропустить поток по ребру
      */
-    explicit FlowNetwork(const GraphType& baseGraph) {
-        for (const auto& v : baseGraph.getVertices()) {
-            addVertex(v);
-        }
-        for (const auto& e : baseGraph.getEdges()) {
-            addEdge(e.source, e.target, e.capacity);
-        }
+    bool hasResidual() const {
+      return residual() > CapacityTraits<Capacity>::epsilon;
     }
+  };
 
-    /**
-     * @brief Добавляет ориентированное ребро в сеть потоков
-     * @param from Исходная вершина ребра
-     * @param to Конечная вершина ребра
-     * @param capacity Пропускная способность ребра
-     * 
-     * @note Автоматически создает обратное ребро с нулевой пропускной способностью.
-     *       Для неориентированных графов используйте addEdge в обоих направлениях
-     */
-    void addEdge(const Vertex& from, const Vertex& to, int capacity) {
-        auto& adjFrom = adjacency[from];
-        auto& adjTo = adjacency[to];
-        
-        adjFrom.emplace_back(to, capacity);
-        adjTo.emplace_back(from, 0);
-        
-        adjFrom.back().reverse = &adjTo.back();
-        adjTo.back().reverse = &adjFrom.back();
+  static_assert(!std::is_same_v<Capacity, int> || sizeof(FlowEdge) == 12,
+                "32-битное ребро должно занимать 12 байт");
+
+  /**
+   * @brief Диапазон номеров исходящих рёбер вершины в CSR-индексе
+   */
+  struct ArcRange {
+    const uint32_t* first;  ///< Первый номер ребра
+    const uint32_t* last;   ///< Конец диапазона
+
+    const uint32_t* begin() const { return first; }
+    const uint32_t* end() const { return last; }
+    size_t size() const { return static_cast<size_t>(last - first); }
+  };
+
+  /**
+   * @brief Конструктор пустой сети
+   */
+  FlowNetwork() = default;
+
+  /**
+   * @brief Конструктор сети потоков на основе существующего графа
+   * @param baseGraph Исходный граф для преобразования в сеть потоков
+   *
+   * @note Автоматически добавляет все вершины и ребра из базового графа,
+   *       инициализируя поле capacity значением из исходного ребра
+   */
+  explicit FlowNetwork(const GraphType& baseGraph) {
+    for (const auto& v : baseGraph.getVertices()) {
+      addVertex(v);
+    }
+    edges.reserve(2 * baseGraph.getEdges().size());
+    tails.reserve(2 * baseGraph.getEdges().size());
+    for (const auto& e : baseGraph.getEdges()) {
+      addEdge(e.source, e.target, static_cast<Capacity>(e.capacity));
     }
+    buildArcIndex();
+  }
 
-    /**
-     * @brief Возвращает список смежных ребер для вершины (только для чтения)
-     * @param v Вершина для получения смежных ребер
-     * @return Константная ссылка на вектор ребер или пустой вектор, если вершина не найдена
-     */
-    const std::vector<FlowEdge>& getAdjacent(const Vertex& v) const {
-        static const std::vector<FlowEdge> empty;
-        auto it = adjacency.find(v);
-        return it != adjacency.end() ? it->second : empty;
+  /**
+   * @brief Добавляет вершину в сеть
+   * @param v Вершина для добавления
+   * @return Индекс вершины (существующей или новой)
+   */
+  size_t addVertex(const Vertex& v) {
+    auto [it, inserted] = vertexToIndex.emplace(v, indexToVertex.size());
+    if (inserted) {
+      indexToVertex.push_back(v);
+      indexed = false;
     }
+    return it->second;
+  }
 
-    /**
-     * @brief Возвращает список смежных ребер для вершины (для модификации)
-     * @param v Вершина для получения смежных ребер
-     * @return Ссылка на вектор ребер (создает пустой вектор, если вершины не существует)
-     */
-    std::vector<FlowEdge>& getAdjacentMut(const Vertex& v) {
-        return adjacency[v];
+  /**
+   * @brief Добавляет ориентированное ребро в сеть потоков
+   * @param from Исходная вершина ребра
+   * @param to Конечная вершина ребра
+   * @param capacity Пропускная способность ребра
+   * @param cost Стоимость единицы потока по ребру (обратное ребро получает
+   * стоимость -cost)
+   * @return Номер добавленного ребра (чётный); обратное ребро имеет номер
+   * на единицу больше
+   *
+   * @note Автоматически создает обратное ребро с нулевой пропускной способностью.
+   *       Для неориентированных графов используйте addEdge в обоих направлениях
+   */
+  size_t addEdge(const Vertex& from, const Vertex& to, Capacity capacity,
+                 int cost = 0) {
+    uint32_t u = static_cast<uint32_t>(addVertex(from));
+    uint32_t v = static_cast<uint32_t>(addVertex(to));
+    size_t id = edges.size();
+    edges.push_back(FlowEdge{v, capacity, 0});
+    edges.push_back(FlowEdge{u, Capacity(0), Capacity(0)});
+    tails.push_back(u);
+    tails.push_back(v);
+    if (cost != 0 || !costs.empty()) {
+      // Массив стоимостей заводится при первой ненулевой стоимости
+      costs.resize(id);
+      costs.push_back(cost);
+      costs.push_back(-cost);
     }
+    indexed = false;
+    return id;
+  }
 
-private:
-    std::unordered_map<Vertex, std::vector<FlowEdge>> adjacency; ///< Хэш-таблица списков смежности
-    
-    /**
-     * @brief Внутренний метод для добавления вершины в сеть
-     * @param v Вершина для добавления
-     */
-    void addVertex(const Vertex& v) {
-        adjacency.emplace(v, std::vector<FlowEdge>{});
+  /**
+   * @brief Перестраивает CSR-индекс исходящих рёбер
+   *
+   * @note Вызывается конструктором и решателями; после ручного добавления
+   *       рёбер и вершин индекс нужно перестроить до вызова getArcs().
+   */
+  void buildArcIndex() {
+    if (indexed) return;
+    const size_t n = indexToVertex.size();
+    offsets.assign(n + 1, 0);
+    for (uint32_t tail : tails) {
+      ++offsets[tail + 1];
+    }
+    for (size_t v = 0; v < n; ++v) {
+      offsets[v + 1] += offsets[v];
+    }
+    arcs.resize(edges.size());
+    std::vector<size_t> cursor(offsets.begin(), offsets.end() - 1);
+    for (size_t id = 0; id < edges.size(); ++id) {
+      arcs[cursor[tails[id]]++] = static_cast<uint32_t>(id);
+    }
+    indexed = true;
+  }
+
+  /**
+   * @brief Возвращает номера исходящих рёбер вершины
+   * @param v Индекс вершины
+   * @return Диапазон номеров рёбер в CSR-индексе
+   */
+  ArcRange getArcs(size_t v) const {
+    return ArcRange{arcs.data() + offsets[v], arcs.data() + offsets[v + 1]};
+  }
+
+  /**
+   * @brief Возвращает ребро по номеру
+   * @param id Номер ребра
+   */
+  FlowEdge& getEdge(size_t id) { return edges[id]; }
+
+  /**
+   * @brief Возвращает ребро по номеру (только для чтения)
+   * @param id Номер ребра
+   */
+  const FlowEdge& getEdge(size_t id) const { return edges[id]; }
+
+  /**
+   * @brief Возвращает стоимость единицы потока по ребру
+   * @param id Номер ребра
+   * @return Стоимость; 0, если ни одному ребру стоимость не задана
+   */
+  int getCost(size_t id) const { return costs.empty() ? 0 : costs[id]; }
+
+  /**
+   * @brief Возвращает номер обратного ребра
+   * @param id Номер ребра
+   */
+  static size_t reverseEdge(size_t id) { return id ^ 1; }
+
+  /**
+   * @brief Возвращает индекс начальной вершины ребра
+   * @param id Номер ребра
+   */
+  size_t getTail(size_t id) const { return tails[id]; }
+
+  /**
+   * @brief Пропускает поток по ребру, обновляя обратное ребро
+   * @param id Номер ребра
+   * @param amount Величина потока
+   */
+  void pushFlow(size_t id, Capacity amount) {
+    edges[id].flow += amount;
+    edges[id ^ 1].flow -= amount;
+  }
+
+  /**
+   * @brief Обнуляет поток на всех рёбрах
+   */
+  void resetFlow() {
+    for (auto& e : edges) {
+      e.flow = 0;
+    }
+  }
+
+  /**
+   * @brief Возвращает величину потока из вершины
+   * @param v Индекс вершины
+   * @return Чистый поток, вытекающий из вершины
+   */
+  Capacity getFlowValue(size_t v) const {
+    Capacity value = 0;
+    for (uint32_t id : getArcs(v)) {
+      value += edges[id].flow;
+    }
+    return value;
+  }
+
+  /**
+   * @brief Готовит текущий поток к дорешиванию между истоком и стоком
+   *
+   * Если на рёбрах лежит допустимый поток из source в sink, он сохраняется,
+   * иначе (поток для другой пары вершин) сеть сбрасывается в нулевой поток.
+   *
+   * @param source Индекс истока
+   * @param sink Индекс стока
+   * @return Величина потока, с которого продолжит решатель
+   */
+  Capacity prepareFlow(size_t source, size_t sink) {
+    constexpr Capacity epsilon = CapacityTraits<Capacity>::epsilon;
+    std::vector<Capacity> balance(indexToVertex.size(), 0);
+    bool valid = true;
+    for (size_t id = 0; id < edges.size(); id += 2) {
+      const FlowEdge& e = edges[id];
+      if (e.flow < -epsilon || e.flow > e.capacity + epsilon) valid = false;
+      balance[tails[id]] -= e.flow;
+      balance[e.target] += e.flow;
+    }
+    for (size_t v = 0; v < balance.size() && valid; ++v) {
+      valid = v == source || v == sink ||
+              (balance[v] <= epsilon && -balance[v] <= epsilon);
+    }
+    if (!valid) {
+      resetFlow();
+      return 0;
+    }
+    return -balance[source];
+  }
+
+  /**
+   * @brief Ищет прямое ребро между вершинами
+   * @param from Исходная вершина
+   * @param to Конечная вершина
+   * @return Номер первого добавленного ребра from -> to
+   * @throws std::out_of_range если такого ребра нет
+   */
+  size_t findEdge(const Vertex& from, const Vertex& to) const {
+    size_t u = getVertexIndex(from);
+    size_t v = getVertexIndex(to);
+    for (size_t id = 0; id < edges.size(); id += 2) {
+      if (tails[id] == u && edges[id].target == v) return id;
+    }
+    throw std::out_of_range("Edge not found");
+  }
+
+  /**
+   * @brief Меняет пропускную способность ребра, сохраняя допустимый поток
+   *
+   * Увеличение только поднимает ёмкость. При уменьшении ниже текущего потока
+   * лишний поток снимается с ребра, после чего сеть чинится: сначала поток
+   * перенаправляется в обход ребра по остаточной сети, а что не удалось
+   * перенаправить, возвращается от начала ребра в исток и снимается с путей
+   * от конца ребра к стоку. Исток и сток сами поглощают дисбаланс, поэтому
+   * для ребра из стока или в исток (поток по нему — циркуляция через
+   * терминал) соответствующая сторона не чинится. Если починить поток не
+   * удалось, он сбрасывается в нулевой. После этого решатели могут
+   * дооптимизировать поток, не начиная с нуля.
+   *
+   * @param id Номер прямого ребра (как вернул addEdge)
+   * @param capacity Новая пропускная способность
+   * @param source Исток текущего потока
+   * @param sink Сток текущего потока
+   * @return На сколько уменьшилась величина потока (отрицательно, если
+   * выросла)
+   * @throws std::out_of_range если ребра с таким номером нет
+   */
+  Capacity setCapacity(size_t id, Capacity capacity, const Vertex& source,
+                  const Vertex& sink) {
+    constexpr Capacity epsilon = CapacityTraits<Capacity>::epsilon;
+    if (id >= edges.size() || id % 2 != 0) {
+      throw std::out_of_range("Edge not found");
+    }
+    size_t s = getVertexIndex(source);
+    size_t t = getVertexIndex(sink);
+    buildArcIndex();
+
+    FlowEdge& edge = edges[id];
+    edge.capacity = capacity;
+    Capacity overflow = edge.flow - std::max(capacity, Capacity(0));
+    if (overflow <= epsilon) return 0;
+
+    // Снимаем лишний поток: в начале ребра избыток, в конце — недостаток
+    Capacity before = getFlowValue(s);
+    pushFlow(id, -overflow);
+    size_t u = tails[id];
+    size_t v = edge.target;
+    Capacity remaining = overflow - augmentResidual(u, v, overflow);
+    if (remaining <= epsilon) return 0;
+
+    Capacity excess = remaining;
+    Capacity deficit = remaining;
+    if (u == s || u == t) {
+      excess = 0;
+    } else {
+      excess -= augmentResidual(u, s, excess);
+    }
+    if (v == s || v == t) {
+      deficit = 0;
+    } else {
+      deficit -= augmentResidual(t, v, deficit);
+    }
+    if (excess > epsilon || deficit > epsilon) resetFlow();
+    return before - getFlowValue(s);
+  }
+
+  /**
+   * @brief Возвращает индекс вершины
+   * @param v Вершина
+   * @return Плотный индекс вершины
+   * @throws std::out_of_range если вершины нет в сети
+   */
+  size_t getVertexIndex(const Vertex& v) const {
+    auto it = vertexToIndex.find(v);
+    if (it == vertexToIndex.end()) {
+      throw std::out_of_range("Vertex not found");
+    }
+    return it->second;
+  }
+
+  /**
+   * @brief Возвращает вершину по индексу
+   * @param index Индекс вершины
+   */
+  const Vertex& getVertex(size_t index) const { return indexToVertex[index]; }
+
+  /**
+   * @brief Возвращает число вершин
+   */
+  size_t vertexCount() const { return indexToVertex.size(); }
+
+  /**
+   * @brief Возвращает число рёбер остаточной сети (вместе с обратными)
+   */
+  size_t edgeCount() const { return edges.size(); }
+
+  /**
+   * @brief Находит вершины, достижимые из истока в остаточной сети
+   *
+   * После вычисления максимального потока это исходная сторона минимального
+   * разреза.
+   *
+   * @param source Индекс истока
+   * @return Признаки принадлежности вершин исходной стороне (по индексам)
+   */
+  std::vector<char> findSourceSide(size_t source) {
+    buildArcIndex();
+    std::vector<char> side(indexToVertex.size(), 0);
+    std::vector<size_t> queue{source};
+    side[source] = 1;
+    for (size_t head = 0; head < queue.size(); ++head) {
+      for (uint32_t id : getArcs(queue[head])) {
+        size_t w = edges[id].target;
+        if (side[w] || !edges[id].hasResidual()) continue;
+        side[w] = 1;
+        queue.push_back(w);
+      }
+    }
+    return side;
+  }
+
+  /**
+   * @brief Возвращает исходную сторону минимального разреза
+   * @param source Исток, для которого вычислен максимальный поток
+   * @return Вершины, достижимые из истока в остаточной сети
+   * @throws std::out_of_range если вершины нет в сети
+   */
+  std::vector<Vertex> getMinCutSourceSide(const Vertex& source) {
+    std::vector<char> side = findSourceSide(getVertexIndex(source));
+    std::vector<Vertex> result;
+    for (size_t v = 0; v < side.size(); ++v) {
+      if (side[v]) result.push_back(indexToVertex[v]);
+    }
+    return result;
+  }
+
+  /**
+   * @brief Возвращает рёбра минимального разреза
+   *
+   * Сумма пропускных способностей возвращённых рёбер равна величине
+   * максимального потока.
+   *
+   * @param source Исток, для которого вычислен максимальный поток
+   * @return Номера прямых рёбер, ведущих из исходной стороны в стоковую
+   * @throws std::out_of_range если вершины нет в сети
+   */
+  std::vector<size_t> getMinCutEdges(const Vertex& source) {
+    std::vector<char> side = findSourceSide(getVertexIndex(source));
+    std::vector<size_t> result;
+    for (size_t id = 0; id < edges.size(); id += 2) {
+      if (side[tails[id]] && !side[edges[id].target] &&
+          edges[id].capacity > CapacityTraits<Capacity>::epsilon) {
+        result.push_back(id);
+      }
+    }
+    return result;
+  }
+
+  /**
+   * @brief Возвращает поток по ребру между вершинами
+   * @param from Исходная вершина
+   * @param to Конечная вершина
+   * @return Суммарный поток по всем прямым рёбрам from -> to
+   */
+  Capacity getFlow(const Vertex& from, const Vertex& to) const {
+    size_t u = getVertexIndex(from);
+    size_t v = getVertexIndex(to);
+    Capacity flow = 0;
+    for (size_t id = 0; id < edges.size(); id += 2) {
+      if (tails[id] == u && edges[id].target == v) flow += edges[id].flow;
+    }
+    return flow;
+  }
+
+ private:
+  std::vector<FlowEdge> edges;  ///< Рёбра парами: i и i ^ 1 взаимно обратны
+  std::vector<uint32_t> tails;  ///< Начальные вершины рёбер
+  /// Стоимости единицы потока по рёбрам; пуст, пока все стоимости нулевые,
+  /// так что сети для максимального потока не платят за них памятью
+  std::vector<int> costs;
+  std::vector<size_t> offsets;  ///< Начало рёбер каждой вершины в arcs
+  std::vector<uint32_t> arcs;   ///< Номера рёбер, сгруппированные по вершинам
+  bool indexed = true;          ///< Актуален ли CSR-индекс
+  std::unordered_map<Vertex, size_t>
+      vertexToIndex;                ///< Индексы вершин
+  std::vector<Vertex> indexToVertex;  ///< Вершины по индексам
+
+  /**
+   * @brief Проталкивает поток по кратчайшим путям остаточной сети
+   * @param from Индекс начальной вершины
+   * @param to Индекс конечной вершины
+   * @param limit Сколько потока нужно провести
+   * @return Сколько удалось провести (не больше limit)
+   */
+  Capacity augmentResidual(size_t from, size_t to, Capacity limit) {
+    constexpr size_t kNoEdge = static_cast<size_t>(-1);
+    std::vector<size_t> parentEdge;
+    std::vector<size_t> queue;
+    Capacity total = 0;
+    while (limit - total > CapacityTraits<Capacity>::epsilon) {
+      parentEdge.assign(indexToVertex.size(), kNoEdge);
+      queue.assign(1, from);
+      bool found = false;
+      for (size_t head = 0; head < queue.size() && !found; ++head) {
+        for (uint32_t id : getArcs(queue[head])) {
+          size_t w = edges[id].target;
+          if (w == from || parentEdge[w] != kNoEdge ||
+              !edges[id].hasResidual()) {
+            continue;
+          }
+          parentEdge[w] = id;
+          if (w == to) {
+            found = true;
+            break;
+          }
+          queue.push_back(w);
+        }
+      }
+      if (!found) break;
+
+      Capacity amount = limit - total;
+      for (size_t w = to; w != from; w = tails[parentEdge[w]]) {
+        amount = std::min(amount, edges[parentEdge[w]].residual());
+      }
+      for (size_t w = to; w != from; w = tails[parentEdge[w]]) {
+        pushFlow(parentEdge[w], amount);
+      }
+      total += amount;
     }
+    return total;
+  }
 };
 
-} // namespace graph
+}  // namespace graph
 
-#endif // FLOW_NETWORK_H
\ No newline at end of file
+#endif  // FLOW_NETWORK_H
@@ -1,10 +1,13 @@
 #ifndef FORD_FULKERSON_H
 #define FORD_FULKERSON_H
 
-#include <stack>
-#include <unordered_set>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
-#include "../bfs_dfs/DFS.h"
 #include "FlowNetwork.h"
 
 namespace graph {
@@ -16,8 +19,15 @@ namespace graph {
  *
  * Этот класс реализует алгоритм Форда-Фалкерсона, который использует поиск в
  * глубину (DFS) для нахождения увеличивающих путей в остаточной сети.
+ * Пути ищутся с масштабированием пропускных способностей: в фазе с порогом Δ
+ * используются только рёбра с остаточной ёмкостью не меньше Δ, а после
+ * каждой фазы Δ уменьшается вдвое. Поэтому число увеличений — O(E log U),
+ * где U — наибольшая пропускная способность, а не O(величина потока).
+ *
+ * @tparam GraphType Тип базового графа.
+ * @tparam Capacity Тип пропускных способностей.
  */
-template <typename GraphType>
+template <typename GraphType, typename Capacity = int>
 class FordFulkerson {
  public:
   /**
@@ -26,7 +36,8 @@ class FordFulkerson {
    * @param network Сеть потоков, для которой будет вычисляться максимальный
    * поток.
    */
-  explicit FordFulkerson(FlowNetwork<GraphType>& network) : network(network) {}
+  explicit FordFulkerson(FlowNetwork<GraphType, Capacity>& network)
+      : network(network) {}
 
   /**
    * @brief Вычисляет максимальный поток в сети.
@@ -35,77 +46,129 @@ class FordFulkerson {
    * @param sink Сток (конечная вершина).
    * @return Значение максимального потока.
    */
-  int computeMaxFlow(const Vertex& source, const Vertex& sink) {
-    int max_flow = 0;
-
-    while (true) {
-      // Используем DFS для поиска увеличивающего пути
-      std::unordered_set<Vertex> visited;
-      int path_flow = findAugmentingPath(source, sink, visited);
-
-      // Если увеличивающий путь не найден, завершаем алгоритм
-      if (path_flow == 0) break;
-
-      max_flow += path_flow;
+  Capacity computeMaxFlow(const Vertex& source, const Vertex& sink) {
+    network.buildArcIndex();
+    size_t s = network.getVertexIndex(source);
+    size_t t = network.getVertexIndex(sink);
+    if (s == t) return 0;
+
+    // Допустимый поток, уже лежащий в сети, служит начальным
+    Capacity max_flow = network.prepareFlow(s, t);
+    for (Capacity delta = initialDelta();
+         delta > CapacityTraits<Capacity>::epsilon; delta /= 2) {
+      max_flow += augmentPhase(s, t, delta);
+    }
+    if constexpr (std::is_floating_point_v<Capacity>) {
+      // Остаток ёмкостей меньше последнего порога
+      max_flow += augmentPhase(s, t, Capacity(0));
     }
-
     return max_flow;
   }
 
  private:
-  FlowNetwork<GraphType>&
+  FlowNetwork<GraphType, Capacity>&
       network;  ///< Сеть потоков, для которой вычисляется максимальный поток.
+  std::vector<uint32_t> visited;  ///< Номер DFS, посетившего вершину.
+  uint32_t epoch = 0;             ///< Номер текущего DFS.
+  std::vector<std::pair<size_t, size_t>>
+      stack;  ///< Стек DFS: вершина и позиция следующей дуги.
+  std::vector<size_t> path;  ///< Рёбра текущего пути от истока.
 
   /**
-   * @brief Поиск увеличивающего пути с использованием DFS.
-   *
-   * @param u Текущая вершина.
-   * @param sink Сток (конечная вершина).
-   * @param visited Множество посещенных вершин.
-   * @return Поток, который можно пропустить по найденному пути.
+   * @brief Начальный порог: наибольшая степень двойки, не превосходящая
+   * наибольшей остаточной ёмкости.
    */
-  int findAugmentingPath(Vertex& u, Vertex& sink,
-                         std::unordered_set<Vertex>& visited) {
-    struct FlowVisitor
-        : public Visitor<Vertex, typename FlowNetwork<GraphType>::FlowEdge> {
-      std::unordered_map<Vertex, Vertex>& parent;
-      int& path_flow;
-
-      FlowVisitor(std::unordered_map<Vertex, Vertex>& p, int& pf)
-          : parent(p), path_flow(pf) {}
-
-      void treeEdge(
-          const typename FlowNetwork<GraphType>::FlowEdge& e) override {
-        parent[e.target] = e.source;
-        path_flow = std::min(path_flow, e.residual());
-      }
-    };
+  Capacity initialDelta() const {
+    Capacity largest = 0;
+    for (size_t id = 0; id < network.edgeCount(); ++id) {
+      largest = std::max(largest, network.getEdge(id).residual());
+    }
+    Capacity delta = 1;
+    while (delta <= largest / 2) delta *= 2;
+    while (delta > largest && delta > CapacityTraits<Capacity>::epsilon) {
+      delta /= 2;
+    }
+    return delta;
+  }
 
-    std::unordered_map<Vertex, Vertex> parent;
-    int path_flow = std::numeric_limits<int>::max();
+  /**
+   * @brief Фаза масштабирования: увеличивает поток, пока есть пути из рёбер
+   * с остаточной ёмкостью не меньше delta.
+   *
+   * @return Суммарный поток, добавленный за фазу.
+   */
+  Capacity augmentPhase(size_t source, size_t sink, Capacity delta) {
+    Capacity total = 0;
+    while (true) {
+      // Используем DFS для поиска увеличивающего пути
+      Capacity path_flow = findAugmentingPath(source, sink, delta);
 
-    FlowVisitor visitor(parent, path_flow);
-    DFS<Vertex, typename FlowNetwork<GraphType>::FlowEdge>(network, u, visitor);
+      // Если увеличивающий путь не найден, фаза завершена
+      if (path_flow <= CapacityTraits<Capacity>::epsilon) break;
 
-    // Если сток не был достигнут, возвращаем 0
-    if (parent.find(sink) == parent.end()) return 0;
+      total += path_flow;
+    }
+    return total;
+  }
 
-    // Обновляем потоки вдоль найденного пути
-    for (Vertex v = sink; v != u; v = parent[v]) {
-      Vertex& u_parent = parent[v];
-      for (auto& e : network.getAdjacentMut(u_parent)) {
-        if (e.target == v) {
-          e.flow += path_flow;
-          e.reverse->flow -= path_flow;
+  /**
+   * @brief Поиск увеличивающего пути с использованием DFS и проталкивание по
+   * нему потока.
+   *
+   * @param source Индекс истока.
+   * @param sink Индекс стока.
+   * @param delta Наименьшая допустимая остаточная ёмкость ребра пути.
+   * @return Поток, пропущенный по найденному пути, или 0, если пути нет.
+   */
+  Capacity findAugmentingPath(size_t source, size_t sink, Capacity delta) {
+    // Метки прошлых обходов устаревают со сменой номера, массив не чистится
+    if (visited.size() != network.vertexCount() || ++epoch == 0) {
+      visited.assign(network.vertexCount(), 0);
+      epoch = 1;
+    }
+    stack.clear();
+    path.clear();
+    stack.emplace_back(source, 0);
+    visited[source] = epoch;
+
+    while (!stack.empty()) {
+      auto& [u, cursor] = stack.back();
+      if (u == sink) break;
+      auto arcs = network.getArcs(u);
+      bool advanced = false;
+      while (cursor < arcs.size()) {
+        uint32_t id = arcs.begin()[cursor++];
+        const auto& e = network.getEdge(id);
+        if (visited[e.target] != epoch && e.hasResidual() &&
+            e.residual() >= delta) {
+          visited[e.target] = epoch;
+          path.push_back(id);
+          stack.emplace_back(e.target, 0);
+          advanced = true;
           break;
         }
       }
+      if (!advanced) {
+        stack.pop_back();
+        if (!path.empty()) path.pop_back();
+      }
     }
 
+    // Если сток не был достигнут, возвращаем 0
+    if (stack.empty()) return 0;
+
+    // Обновляем потоки вдоль найденного пути
+    Capacity path_flow = std::numeric_limits<Capacity>::max();
+    for (size_t id : path) {
+      path_flow = std::min(path_flow, network.getEdge(id).residual());
+    }
+    for (size_t id : path) {
+      network.pushFlow(id, path_flow);
+    }
     return path_flow;
   }
 };
 
 }  // namespace graph
 
-#endif  // FORD_FULKERSON_H
\ No newline at end of file
+#endif  // FORD_FULKERSON_H
@@ -0,0 +1,221 @@
+#ifndef GOMORY_HU_TREE_H
+#define GOMORY_HU_TREE_H
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../parallel/ParallelFor.h"
+#include "Dinic.h"
+#include "FlowNetwork.h"
+
+namespace graph {
+
+/**
+ * @brief Ребро дерева Гомори–Ху.
+ * @tparam Capacity Тип пропускных способностей.
+ */
+template <typename Capacity = int>
+struct GomoryHuEdge {
+  Vertex child;     ///< Вершина-потомок.
+  Vertex parent;    ///< Вершина-родитель.
+  Capacity weight;  ///< Величина минимального разреза между ними.
+};
+
+/**
+ * @class GomoryHuTree
+ * @brief Дерево Гомори–Ху неориентированной сети, построенное алгоритмом
+ * Гасфилда.
+ *
+ * Алгоритм Гасфилда делает n - 1 вычислений максимального потока в исходной
+ * сети без стягивания вершин: i-я итерация ищет разрез между вершиной i и её
+ * текущим родителем и перевешивает вершины, оказавшиеся на стороне i.
+ * Итерации выполняются пакетами по числу потоков: разрезы пакета считаются
+ * параллельно на копиях сети, а затем применяются по порядку. Результат
+ * итерации применим, если родитель вершины не изменился с момента запуска;
+ * первая же устаревшая итерация и все следующие за ней переходят в новый
+ * пакет, поэтому дерево совпадает с последовательным алгоритмом.
+ *
+ * Минимальный разрез между любыми двумя вершинами равен наименьшему весу
+ * ребра на пути между ними в дереве.
+ *
+ * @tparam GraphType Тип базового графа.
+ * @tparam Capacity Тип пропускных способностей.
+ */
+template <typename GraphType, typename Capacity = int>
+class GomoryHuTree {
+ public:
+  /**
+   * @brief Строит дерево Гомори–Ху.
+   *
+   * @param network Неориентированная сеть: каждое ребро задано в обоих
+   * направлениях с одинаковой пропускной способностью (например, сеть,
+   * построенная по UndirectedGraph).
+   * @param threadCount Число потоков для вычисления разрезов.
+   */
+  explicit GomoryHuTree(const FlowNetwork<GraphType, Capacity>& network,
+                        size_t threadCount = defaultThreadCount()) {
+    const size_t n = network.vertexCount();
+    vertices.reserve(n);
+    for (size_t v = 0; v < n; ++v) {
+      vertices.push_back(network.getVertex(v));
+      vertexToIndex.emplace(vertices.back(), v);
+    }
+    parent.assign(n, kNone);
+    weight.assign(n, 0);
+    if (n > 1) build(network, std::max<size_t>(threadCount, 1));
+    computeDepths();
+  }
+
+  /**
+   * @brief Возвращает величину минимального разреза между вершинами.
+   *
+   * Время работы пропорционально длине пути между вершинами в дереве.
+   *
+   * @param u Первая вершина.
+   * @param v Вторая вершина.
+   * @return Величина минимального разреза (0 для u == v).
+   * @throws std::out_of_range Если вершины нет в сети.
+   */
+  Capacity minCutValue(const Vertex& u, const Vertex& v) const {
+    size_t a = getIndex(u);
+    size_t b = getIndex(v);
+    if (a == b) return 0;
+    Capacity result = std::numeric_limits<Capacity>::max();
+    while (a != b) {
+      if (depth[a] < depth[b]) std::swap(a, b);
+      result = std::min(result, weight[a]);
+      a = parent[a];
+    }
+    return result;
+  }
+
+  /**
+   * @brief Возвращает рёбра дерева.
+   * @return n - 1 рёбер; корень дерева — вершина с индексом 0.
+   */
+  std::vector<GomoryHuEdge<Capacity>> getTreeEdges() const {
+    std::vector<GomoryHuEdge<Capacity>> result;
+    for (size_t v = 0; v < vertices.size(); ++v) {
+      if (parent[v] == kNone) continue;
+      result.push_back(GomoryHuEdge<Capacity>{vertices[v], vertices[parent[v]],
+                                              weight[v]});
+    }
+    return result;
+  }
+
+ private:
+  static constexpr size_t kNone = static_cast<size_t>(-1);  ///< Нет вершины.
+
+  std::vector<Vertex> vertices;  ///< Вершины по индексам сети.
+  std::unordered_map<Vertex, size_t> vertexToIndex;  ///< Индексы вершин.
+  std::vector<size_t> parent;  ///< Родитель вершины в дереве.
+  std::vector<Capacity> weight;  ///< Вес ребра к родителю.
+  std::vector<size_t> depth;   ///< Глубина вершины в дереве.
+
+  /**
+   * @brief Результат одной итерации алгоритма Гасфилда.
+   */
+  struct Cut {
+    size_t vertex = 0;       ///< Вершина итерации.
+    size_t target = 0;       ///< Родитель на момент запуска.
+    Capacity value = 0;      ///< Величина разреза.
+    std::vector<char> side;  ///< Сторона разреза, содержащая vertex.
+  };
+
+  /**
+   * @brief Возвращает индекс вершины.
+   * @throws std::out_of_range Если вершины нет в сети.
+   */
+  size_t getIndex(const Vertex& v) const {
+    auto it = vertexToIndex.find(v);
+    if (it == vertexToIndex.end()) {
+      throw std::out_of_range("Vertex not found");
+    }
+    return it->second;
+  }
+
+  /**
+   * @brief Выполняет итерации алгоритма Гасфилда пакетами.
+   */
+  void build(const FlowNetwork<GraphType, Capacity>& network, size_t threads) {
+    const size_t n = vertices.size();
+    std::fill(parent.begin() + 1, parent.end(), 0);
+    threads = std::min(threads, n - 1);
+    std::vector<FlowNetwork<GraphType, Capacity>> copies(threads, network);
+    std::vector<Cut> batch;
+
+    size_t next = 1;
+    while (next < n) {
+      batch.assign(std::min(threads, n - next), Cut{});
+      for (size_t j = 0; j < batch.size(); ++j) {
+        batch[j].vertex = next + j;
+        batch[j].target = parent[next + j];
+      }
+      parallelFor(
+          0, batch.size(), batch.size(),
+          [&](size_t j) {
+            FlowNetwork<GraphType, Capacity>& copy = copies[j];
+            Cut& cut = batch[j];
+            copy.resetFlow();
+            DinicSolver<GraphType, Capacity> dinic(copy);
+            cut.value = dinic.computeMaxFlow(vertices[cut.vertex],
+                                             vertices[cut.target]);
+            cut.side = copy.findSourceSide(cut.vertex);
+          },
+          1);
+
+      for (const Cut& cut : batch) {
+        if (parent[cut.vertex] != cut.target) break;
+        apply(cut);
+        ++next;
+      }
+    }
+  }
+
+  /**
+   * @brief Применяет разрез итерации к дереву.
+   */
+  void apply(const Cut& cut) {
+    size_t s = cut.vertex;
+    size_t t = cut.target;
+    weight[s] = cut.value;
+    for (size_t i = 0; i < vertices.size(); ++i) {
+      if (i != s && cut.side[i] && parent[i] == t) parent[i] = s;
+    }
+    // Родитель t на стороне s: s встаёт между t и его родителем
+    if (parent[t] != kNone && cut.side[parent[t]]) {
+      parent[s] = parent[t];
+      parent[t] = s;
+      weight[s] = weight[t];
+      weight[t] = cut.value;
+    }
+  }
+
+  /**
+   * @brief Вычисляет глубины вершин от корня.
+   */
+  void computeDepths() {
+    const size_t n = vertices.size();
+    depth.assign(n, kNone);
+    std::vector<size_t> path;
+    for (size_t v = 0; v < n; ++v) {
+      size_t u = v;
+      while (depth[u] == kNone && parent[u] != kNone) {
+        path.push_back(u);
+        u = parent[u];
+      }
+      if (depth[u] == kNone) depth[u] = 0;
+      for (; !path.empty(); path.pop_back()) {
+        depth[path.back()] = depth[parent[path.back()]] + 1;
+      }
+    }
+  }
+};
+
+}  // namespace graph
+
+#endif  // GOMORY_HU_TREE_H
@@ -0,0 +1,301 @@
+#ifndef MIN_COST_FLOW_H
+#define MIN_COST_FLOW_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Dinic.h"
+#include "FlowNetwork.h"
+
+namespace graph {
+
+/**
+ * @brief Метод поиска потока минимальной стоимости.
+ */
+enum class MinCostFlowMethod {
+  SuccessiveShortestPaths,  ///< Последовательные кратчайшие пути.
+  CostScaling               ///< Масштабирование стоимостей.
+};
+
+/**
+ * @brief Результат поиска максимального потока минимальной стоимости.
+ */
+struct MinCostFlowResult {
+  int flow = 0;                ///< Величина потока.
+  long long cost = 0;          ///< Суммарная стоимость потока.
+  std::vector<int> edgeFlows;  ///< Потоки по рёбрам в порядке добавления.
+};
+
+/**
+ * @class MinCostFlowSolver
+ * @brief Класс для поиска максимального потока минимальной стоимости.
+ *
+ * Метод последовательных кратчайших путей ищет пути Дейкстрой на двоичной
+ * куче по приведённым стоимостям с потенциалами Джонсона (начальные
+ * потенциалы при отрицательных стоимостях считаются Беллманом–Фордом).
+ * Метод масштабирования стоимостей строит максимальный поток алгоритмом
+ * Диница, а затем делает его оптимальным ε-уточнениями с проталкиванием
+ * (Голдберг–Тарьян), уменьшая ε в kScaleFactor раз за фазу; он быстрее на
+ * больших сетях и допускает циклы отрицательной стоимости.
+ */
+template <typename GraphType>
+class MinCostFlowSolver {
+ public:
+  /**
+   * @brief Конструктор решателя.
+   *
+   * @param network Сеть со стоимостями рёбер.
+   * @param method Метод решения.
+   */
+  explicit MinCostFlowSolver(
+      FlowNetwork<GraphType>& network,
+      MinCostFlowMethod method = MinCostFlowMethod::SuccessiveShortestPaths)
+      : network(network), method(method) {}
+
+  /**
+   * @brief Вычисляет максимальный поток минимальной стоимости.
+   *
+   * Текущий поток в сети сбрасывается, по завершении в сети лежит найденный
+   * поток.
+   *
+   * @param source Исток (начальная вершина).
+   * @param sink Сток (конечная вершина).
+   * @return Величина потока, его стоимость и потоки по рёбрам.
+   * @throws std::runtime_error Если методу последовательных кратчайших путей
+   * встретился цикл отрицательной стоимости.
+   */
+  MinCostFlowResult computeMinCostMaxFlow(const Vertex& source,
+                                          const Vertex& sink) {
+    network.buildArcIndex();
+    network.resetFlow();
+    size_t s = network.getVertexIndex(source);
+    size_t t = network.getVertexIndex(sink);
+
+    MinCostFlowResult result;
+    if (s != t) {
+      result.flow = method == MinCostFlowMethod::CostScaling
+                        ? costScaling(source, sink)
+                        : successiveShortestPaths(s, t);
+    }
+
+    result.edgeFlows.resize(network.edgeCount() / 2);
+    for (size_t id = 0; id < network.edgeCount(); id += 2) {
+      int flow = network.getEdge(id).flow;
+      result.edgeFlows[id / 2] = flow;
+      result.cost += static_cast<long long>(flow) * network.getCost(id);
+    }
+    return result;
+  }
+
+ private:
+  static constexpr long long kInfinity =
+      std::numeric_limits<long long>::max();  ///< Недостижимая вершина.
+  static constexpr long long kScaleFactor = 8;  ///< Уменьшение ε за фазу.
+  static constexpr size_t kNoEdge = static_cast<size_t>(-1);  ///< Нет ребра.
+
+  FlowNetwork<GraphType>& network;  ///< Сеть со стоимостями рёбер.
+  MinCostFlowMethod method;         ///< Метод решения.
+  std::vector<long long> potential;  ///< Потенциалы (цены) вершин.
+  std::vector<long long> distance;   ///< Расстояния Дейкстры.
+  std::vector<size_t> parentEdge;    ///< Рёбра дерева кратчайших путей.
+
+  /**
+   * @brief Начальные потенциалы Беллманом–Фордом (очередь, SPFA).
+   *
+   * Вершину можно законно улучшать много раз, поэтому цикл распознаётся по
+   * числу рёбер текущего кратчайшего пути: путь из n рёбер повторяет вершину.
+   *
+   * @param source Индекс истока.
+   * @throws std::runtime_error Если найден цикл отрицательной стоимости.
+   */
+  void initializePotentials(size_t source) {
+    const size_t n = network.vertexCount();
+    bool negative = false;
+    for (size_t id = 0; id < network.edgeCount() && !negative; ++id) {
+      negative = network.getEdge(id).residual() > 0 && network.getCost(id) < 0;
+    }
+    potential.assign(n, 0);
+    if (!negative) return;
+
+    distance.assign(n, kInfinity);
+    std::vector<size_t> pathLength(n, 0);
+    std::vector<char> queued(n, 0);
+    std::deque<size_t> queue{source};
+    distance[source] = 0;
+    queued[source] = 1;
+    while (!queue.empty()) {
+      size_t u = queue.front();
+      queue.pop_front();
+      queued[u] = 0;
+      for (uint32_t id : network.getArcs(u)) {
+        const auto& e = network.getEdge(id);
+        if (e.residual() <= 0) continue;
+        long long candidate = distance[u] + network.getCost(id);
+        if (candidate >= distance[e.target]) continue;
+        distance[e.target] = candidate;
+        pathLength[e.target] = pathLength[u] + 1;
+        if (pathLength[e.target] >= n) {
+          throw std::runtime_error("Граф содержит отрицательный цикл");
+        }
+        if (!queued[e.target]) {
+          queued[e.target] = 1;
+          queue.push_back(e.target);
+        }
+      }
+    }
+    for (size_t v = 0; v < n; ++v) {
+      if (distance[v] != kInfinity) potential[v] = distance[v];
+    }
+  }
+
+  /**
+   * @brief Дейкстра по приведённым стоимостям.
+   * @return true, если сток достижим.
+   */
+  bool dijkstra(size_t source, size_t sink) {
+    distance.assign(network.vertexCount(), kInfinity);
+    parentEdge.assign(network.vertexCount(), kNoEdge);
+    using Entry = std::pair<long long, uint32_t>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+    distance[source] = 0;
+    heap.emplace(0, static_cast<uint32_t>(source));
+    while (!heap.empty()) {
+      auto [d, u] = heap.top();
+      heap.pop();
+      if (d != distance[u]) continue;
+      for (uint32_t id : network.getArcs(u)) {
+        const auto& e = network.getEdge(id);
+        if (e.residual() <= 0) continue;
+        long long reduced =
+            network.getCost(id) + potential[u] - potential[e.target];
+        if (d + reduced < distance[e.target]) {
+          distance[e.target] = d + reduced;
+          parentEdge[e.target] = id;
+          heap.emplace(distance[e.target], e.target);
+        }
+      }
+    }
+    return distance[sink] != kInfinity;
+  }
+
+  /**
+   * @brief Метод последовательных кратчайших путей.
+   * @return Величина потока.
+   */
+  int successiveShortestPaths(size_t source, size_t sink) {
+    initializePotentials(source);
+    int flow = 0;
+    while (dijkstra(source, sink)) {
+      for (size_t v = 0; v < network.vertexCount(); ++v) {
+        if (distance[v] != kInfinity) potential[v] += distance[v];
+      }
+      int pathFlow = std::numeric_limits<int>::max();
+      for (size_t v = sink; v != source; v = network.getTail(parentEdge[v])) {
+        pathFlow = std::min(pathFlow, network.getEdge(parentEdge[v]).residual());
+      }
+      for (size_t v = sink; v != source; v = network.getTail(parentEdge[v])) {
+        network.pushFlow(parentEdge[v], pathFlow);
+      }
+      flow += pathFlow;
+    }
+    return flow;
+  }
+
+  /**
+   * @brief Метод масштабирования стоимостей.
+   * @return Величина потока.
+   */
+  int costScaling(const Vertex& source, const Vertex& sink) {
+    DinicSolver<GraphType> dinic(network);
+    int flow = dinic.computeMaxFlow(source, sink);
+
+    // Стоимости умножаются на n + 1: 1-оптимальность в новых единицах
+    // означает оптимальность в исходных
+    const size_t n = network.vertexCount();
+    const long long scale = static_cast<long long>(n) + 1;
+    long long epsilon = 0;
+    for (size_t id = 0; id < network.edgeCount(); ++id) {
+      epsilon = std::max<long long>(
+          epsilon, std::abs(static_cast<long long>(network.getCost(id))) *
+                       scale);
+    }
+    potential.assign(n, 0);
+    while (epsilon > 1) {
+      epsilon = std::max<long long>(1, epsilon / kScaleFactor);
+      refine(epsilon, scale);
+    }
+    return flow;
+  }
+
+  /**
+   * @brief Делает текущий поток ε-оптимальным.
+   * @param epsilon Точность.
+   * @param scale Множитель стоимостей.
+   */
+  void refine(long long epsilon, long long scale) {
+    const size_t n = network.vertexCount();
+    auto reducedCost = [&](size_t id) {
+      return network.getCost(id) * scale + potential[network.getTail(id)] -
+             potential[network.getEdge(id).target];
+    };
+
+    // Насыщаем все рёбра с отрицательной приведённой стоимостью
+    std::vector<int> excess(n, 0);
+    for (size_t id = 0; id < network.edgeCount(); ++id) {
+      int residual = network.getEdge(id).residual();
+      if (residual <= 0 || reducedCost(id) >= 0) continue;
+      network.pushFlow(id, residual);
+      excess[network.getTail(id)] -= residual;
+      excess[network.getEdge(id).target] += residual;
+    }
+
+    std::vector<size_t> current(n, 0);
+    std::deque<size_t> active;
+    for (size_t v = 0; v < n; ++v) {
+      if (excess[v] > 0) active.push_back(v);
+    }
+    while (!active.empty()) {
+      size_t v = active.front();
+      active.pop_front();
+      while (excess[v] > 0) {
+        auto arcs = network.getArcs(v);
+        for (; current[v] < arcs.size(); ++current[v]) {
+          uint32_t id = arcs.begin()[current[v]];
+          auto& e = network.getEdge(id);
+          if (e.residual() <= 0 || reducedCost(id) >= 0) continue;
+          int delta = std::min(excess[v], e.residual());
+          size_t w = e.target;
+          network.pushFlow(id, delta);
+          excess[v] -= delta;
+          excess[w] += delta;
+          if (excess[w] > 0 && excess[w] <= delta) active.push_back(w);
+          if (excess[v] == 0) break;
+        }
+        if (excess[v] == 0) break;
+
+        // Допустимых рёбер нет: понижаем цену вершины
+        long long best = std::numeric_limits<long long>::min();
+        for (uint32_t id : arcs) {
+          const auto& e = network.getEdge(id);
+          if (e.residual() <= 0) continue;
+          best = std::max(best, potential[e.target] -
+                                    network.getCost(id) * scale - epsilon);
+        }
+        potential[v] = best;
+        current[v] = 0;
+      }
+    }
+  }
+};
+
+}  // namespace graph
+
+#endif  // MIN_COST_FLOW_H
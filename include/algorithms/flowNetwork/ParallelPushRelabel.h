@@ -0,0 +1,271 @@
+#ifndef PARALLEL_PUSH_RELABEL_H
+#define PARALLEL_PUSH_RELABEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "../parallel/ParallelFor.h"
+#include "FlowNetwork.h"
+
+namespace graph {
+
+/**
+ * @class ParallelPushRelabelSolver
+ * @brief Многопоточный решатель задачи о максимальном потоке методом
+ * проталкивания предпотока.
+ *
+ * Работа идёт раундами. В фазе проталкивания все активные вершины
+ * разгружаются параллельно при замороженных высотах: ребро u -> v допустимо
+ * только при h(u) = h(v) + 1, поэтому по каждой паре взаимно обратных рёбер
+ * в раунде толкает не больше одной вершины, и потоки на рёбрах меняются без
+ * блокировок. Избытки — атомарные счётчики; вершина, чей избыток стал
+ * положительным, попадает в очередь активных вершин того потока, который в
+ * неё протолкнул. В фазе подъёма вершины без допустимых рёбер параллельно
+ * поднимают высоты (высоты только растут, поэтому чтение соседних высот во
+ * время их изменения безопасно). Высоты периодически пересчитываются
+ * параллельным обратным BFS от стока; gap heuristic не используется.
+ *
+ * Вторая фаза тем же механизмом возвращает избыток, не дошедший до стока,
+ * в исток, так что по завершении на рёбрах лежит допустимый поток.
+ *
+ * Потоки создаются один раз вместе с решателем (WorkerTeam) и переиспользуются
+ * всеми раундами и уровнями BFS.
+ */
+template <typename GraphType>
+class ParallelPushRelabelSolver {
+ public:
+  /**
+   * @brief Конструктор решателя.
+   *
+   * @param network Сеть, для которой будет вычисляться максимальный поток.
+   * @param threadCount Число потоков.
+   */
+  explicit ParallelPushRelabelSolver(FlowNetwork<GraphType>& network,
+                                     size_t threadCount = defaultThreadCount())
+      : network(network), team(threadCount) {}
+
+  /**
+   * @brief Вычисляет максимальный поток в сети.
+   *
+   * @param source Исток (начальная вершина).
+   * @param sink Сток (конечная вершина).
+   * @return Значение максимального потока.
+   */
+  int computeMaxFlow(const Vertex& source, const Vertex& sink) {
+    network.buildArcIndex();
+    s = network.getVertexIndex(source);
+    t = network.getVertexIndex(sink);
+    if (s == t) return 0;
+
+    n = network.vertexCount();
+    height = std::vector<std::atomic<uint32_t>>(n);
+    excess = std::vector<std::atomic<int>>(n);
+    queued = std::vector<std::atomic<bool>>(n);
+    current.assign(n, 0);
+    localActive.assign(team.size(), {});
+    localRelabel.assign(team.size(), {});
+    // Допустимый поток, уже лежащий в сети, служит начальным
+    const int initialFlow = network.prepareFlow(s, t);
+
+    // Насыщаем рёбра истока
+    for (uint32_t id : network.getArcs(s)) {
+      auto& e = network.getEdge(id);
+      int delta = e.residual();
+      if (delta <= 0) continue;
+      network.pushFlow(id, delta);
+      excess[e.target].fetch_add(delta, std::memory_order_relaxed);
+      excess[s].fetch_sub(delta, std::memory_order_relaxed);
+    }
+
+    // Сначала доводим избыток до стока, затем возвращаем остаток в исток
+    run(t, s);
+    int maxFlow = initialFlow + excess[t].load(std::memory_order_relaxed);
+    run(s, t);
+    return maxFlow;
+  }
+
+ private:
+  static constexpr size_t kGrain = 64;        ///< Размер порции вершин.
+  static constexpr size_t kRelabelWork = 12;  ///< Стоимость одного подъёма.
+
+  FlowNetwork<GraphType>& network;  ///< Сеть, для которой вычисляется поток.
+  WorkerTeam team;                  ///< Потоки решателя.
+  size_t n = 0;                     ///< Число вершин.
+  size_t s = 0;                     ///< Индекс истока.
+  size_t t = 0;                     ///< Индекс стока.
+  std::vector<std::atomic<uint32_t>> height;  ///< Высоты вершин.
+  std::vector<std::atomic<int>> excess;       ///< Избытки вершин.
+  std::vector<std::atomic<bool>> queued;  ///< Стоит ли вершина в очереди.
+  std::vector<size_t> current;            ///< Текущие дуги вершин.
+  std::vector<uint32_t> active;  ///< Активные вершины текущего раунда.
+  std::vector<std::vector<uint32_t>>
+      localActive;  ///< Очереди активных вершин следующего раунда по потокам.
+  std::vector<std::vector<uint32_t>>
+      localRelabel;  ///< Вершины, которым нужен подъём, по потокам.
+
+  /**
+   * @brief Проталкивает весь избыток в заданную вершину.
+   * @param target Вершина, поглощающая избыток (сток или исток).
+   * @param excluded Второй полюс, через который поток не идёт.
+   */
+  void run(size_t target, size_t excluded) {
+    const size_t relabelThreshold = 6 * n + network.edgeCount() / 2;
+    globalRelabel(target, excluded);
+    size_t workSinceRelabel = 0;
+    while (!active.empty()) {
+      advanceFrontier(
+          team, active, localActive,
+          [&](uint32_t v, size_t worker) { discharge(v, worker); }, kGrain);
+
+      std::atomic<size_t> work{0};
+      team.run([&](size_t worker) {
+        size_t local = 0;
+        for (uint32_t v : localRelabel[worker]) {
+          local += relabel(v);
+        }
+        localRelabel[worker].clear();
+        work.fetch_add(local, std::memory_order_relaxed);
+      });
+
+      workSinceRelabel += work.load();
+      if (workSinceRelabel > relabelThreshold) {
+        globalRelabel(target, excluded);
+        workSinceRelabel = 0;
+      }
+    }
+  }
+
+  /**
+   * @brief Ставит вершину в очередь следующего раунда, если её там ещё нет.
+   */
+  void enqueue(size_t v, size_t worker) {
+    if (!queued[v].exchange(true, std::memory_order_relaxed)) {
+      localActive[worker].push_back(static_cast<uint32_t>(v));
+    }
+  }
+
+  /**
+   * @brief Проталкивает избыток вершины по допустимым рёбрам.
+   * @param v Индекс активной вершины.
+   * @param worker Номер потока.
+   */
+  void discharge(size_t v, size_t worker) {
+    queued[v].store(false, std::memory_order_relaxed);
+    uint32_t h = height[v].load(std::memory_order_relaxed);
+    if (h >= n) return;
+    int amount = excess[v].load(std::memory_order_relaxed);
+    if (amount <= 0) return;
+
+    int remaining = amount;
+    auto arcs = network.getArcs(v);
+    for (; current[v] < arcs.size(); ++current[v]) {
+      uint32_t id = arcs.begin()[current[v]];
+      auto& e = network.getEdge(id);
+      size_t w = e.target;
+      // Сначала высота: ребро допустимо только для одного из концов
+      if (height[w].load(std::memory_order_relaxed) + 1 != h) continue;
+      int residual = e.residual();
+      if (residual <= 0) continue;
+      int delta = std::min(remaining, residual);
+      network.pushFlow(id, delta);
+      remaining -= delta;
+      int prior = excess[w].fetch_add(delta, std::memory_order_relaxed);
+      if (prior == 0 && w != s && w != t) enqueue(w, worker);
+      if (remaining == 0) break;
+    }
+
+    int pushed = amount - remaining;
+    int left = excess[v].fetch_sub(pushed, std::memory_order_relaxed) - pushed;
+    if (remaining > 0) localRelabel[worker].push_back(static_cast<uint32_t>(v));
+    if (left > 0) enqueue(v, worker);
+  }
+
+  /**
+   * @brief Поднимает вершину до минимальной высоты соседа по остаточному
+   * ребру плюс один.
+   * @param v Индекс вершины без допустимых рёбер.
+   * @return Объём выполненной работы.
+   */
+  size_t relabel(size_t v) {
+    auto arcs = network.getArcs(v);
+    uint32_t newHeight = static_cast<uint32_t>(n);
+    size_t best = 0;
+    for (size_t i = 0; i < arcs.size(); ++i) {
+      const auto& e = network.getEdge(arcs.begin()[i]);
+      if (e.residual() <= 0) continue;
+      uint32_t candidate =
+          height[e.target].load(std::memory_order_relaxed) + 1;
+      if (candidate < newHeight) {
+        newHeight = candidate;
+        best = i;
+      }
+    }
+    newHeight = std::max(newHeight, height[v].load(std::memory_order_relaxed));
+    height[v].store(newHeight, std::memory_order_relaxed);
+    current[v] = best;
+    return kRelabelWork + arcs.size();
+  }
+
+  /**
+   * @brief Параллельно пересчитывает высоты обратным BFS и собирает
+   * активные вершины.
+   * @param target Вершина, от которой считаются расстояния.
+   * @param excluded Вершина, через которую обход не идёт.
+   */
+  void globalRelabel(size_t target, size_t excluded) {
+    const uint32_t unreached = static_cast<uint32_t>(n);
+    team.forEach(0, n, [&](size_t v, size_t) {
+      height[v].store(unreached, std::memory_order_relaxed);
+      current[v] = 0;
+    }, 1024);
+    height[target].store(0, std::memory_order_relaxed);
+
+    std::vector<uint32_t> frontier{static_cast<uint32_t>(target)};
+    for (uint32_t level = 1; !frontier.empty(); ++level) {
+      advanceFrontier(
+          team, frontier, localActive,
+          [&](uint32_t v, size_t worker) {
+            for (uint32_t id : network.getArcs(v)) {
+              size_t w = network.getEdge(id).target;
+              if (w == excluded ||
+                  height[w].load(std::memory_order_relaxed) != unreached) {
+                continue;
+              }
+              // Ребро w -> v остаточной сети — обратное к id
+              if (network.getEdge(FlowNetwork<GraphType>::reverseEdge(id))
+                      .residual() <= 0) {
+                continue;
+              }
+              uint32_t expected = unreached;
+              if (height[w].compare_exchange_strong(
+                      expected, level, std::memory_order_relaxed)) {
+                localActive[worker].push_back(static_cast<uint32_t>(w));
+              }
+            }
+          },
+          kGrain);
+    }
+
+    // Активны вершины с избытком, от которых достижима цель
+    team.run([&](size_t worker) {
+      for (size_t v = worker; v < n; v += team.size()) {
+        queued[v].store(false, std::memory_order_relaxed);
+        if (v == s || v == t) continue;
+        if (excess[v].load(std::memory_order_relaxed) <= 0) continue;
+        if (height[v].load(std::memory_order_relaxed) >= unreached) continue;
+        enqueue(v, worker);
+      }
+    });
+    active.clear();
+    for (auto& list : localActive) {
+      active.insert(active.end(), list.begin(), list.end());
+      list.clear();
+    }
+  }
+};
+
+}  // namespace graph
+
+#endif  // PARALLEL_PUSH_RELABEL_H
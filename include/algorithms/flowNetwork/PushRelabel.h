@@ -0,0 +1,345 @@
+#ifndef PUSH_RELABEL_H
+#define PUSH_RELABEL_H
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "FlowNetwork.h"
+
+namespace graph {
+
+/**
+ * @brief Правило выбора активной вершины в алгоритме проталкивания предпотока.
+ */
+enum class PushRelabelRule {
+  HighestLabel,  ///< Вершина с наибольшей высотой.
+  Fifo           ///< Очередь активных вершин.
+};
+
+/**
+ * @class PushRelabelSolver
+ * @brief Класс для решения задачи нахождения максимального потока методом
+ * проталкивания предпотока (push-relabel).
+ *
+ * Первая фаза строит максимальный предпоток: активные вершины выбираются по
+ * наибольшей высоте или в порядке очереди, высоты периодически
+ * пересчитываются обратным BFS от стока (global relabeling), а при появлении
+ * пустого уровня высот все вершины выше него отсекаются (gap heuristic).
+ * Вторая фаза возвращает избыток, не дошедший до стока, обратно в исток,
+ * превращая предпоток в поток.
+ */
+template <typename GraphType>
+class PushRelabelSolver {
+ public:
+  /**
+   * @brief Конструктор класса PushRelabelSolver.
+   *
+   * @param network Сеть, для которой будет вычисляться максимальный поток.
+   * @param rule Правило выбора активной вершины.
+   */
+  explicit PushRelabelSolver(
+      FlowNetwork<GraphType>& network,
+      PushRelabelRule rule = PushRelabelRule::HighestLabel)
+      : network(network), rule(rule) {}
+
+  /**
+   * @brief Вычисляет максимальный поток в сети.
+   *
+   * @param source Исток (начальная вершина).
+   * @param sink Сток (конечная вершина).
+   * @return Значение максимального потока.
+   */
+  int computeMaxFlow(const Vertex& source, const Vertex& sink) {
+    network.buildArcIndex();
+    s = network.getVertexIndex(source);
+    t = network.getVertexIndex(sink);
+    if (s == t) return 0;
+
+    n = network.vertexCount();
+    height.assign(n, 0);
+    excess.assign(n, 0);
+    current.assign(n, 0);
+    levelHead.assign(n, kNone);
+    levelNext.assign(n, kNone);
+    levelPrev.assign(n, kNone);
+    activeBuckets.assign(n, {});
+    fifo.clear();
+    // Допустимый поток, уже лежащий в сети, служит начальным
+    const int initialFlow = network.prepareFlow(s, t);
+
+    // Насыщаем рёбра истока
+    for (uint32_t id : network.getArcs(s)) {
+      auto& e = network.getEdge(id);
+      int delta = e.residual();
+      if (delta <= 0) continue;
+      network.pushFlow(id, delta);
+      excess[e.target] += delta;
+      excess[s] -= delta;
+    }
+
+    globalRelabel();
+    const size_t relabelThreshold = 6 * n + network.edgeCount() / 2;
+    size_t work = 0;
+    for (size_t v = selectActive(); v != kNone; v = selectActive()) {
+      work += discharge(v);
+      if (work > relabelThreshold) {
+        globalRelabel();
+        work = 0;
+      }
+    }
+
+    int maxFlow = initialFlow + excess[t];
+    returnExcessToSource();
+    return maxFlow;
+  }
+
+ private:
+  static constexpr size_t kNone = static_cast<size_t>(-1);  ///< Нет вершины.
+  static constexpr size_t kRelabelWork = 12;  ///< Стоимость одного relabel.
+
+  FlowNetwork<GraphType>& network;  ///< Сеть, для которой вычисляется поток.
+  PushRelabelRule rule;             ///< Правило выбора активной вершины.
+  size_t n = 0;                     ///< Число вершин.
+  size_t s = 0;                     ///< Индекс истока.
+  size_t t = 0;                     ///< Индекс стока.
+  std::vector<size_t> height;       ///< Высоты (метки) вершин.
+  std::vector<int> excess;          ///< Избытки вершин.
+  std::vector<size_t> current;      ///< Текущие дуги вершин.
+  std::vector<size_t> levelHead;    ///< Первая вершина каждого уровня.
+  std::vector<size_t> levelNext;    ///< Следующая вершина того же уровня.
+  std::vector<size_t> levelPrev;    ///< Предыдущая вершина того же уровня.
+  size_t maxLevel = 0;              ///< Наибольший непустой уровень.
+  std::vector<std::vector<uint32_t>>
+      activeBuckets;       ///< Активные вершины по высотам.
+  size_t maxActive = 0;    ///< Верхняя граница высот активных вершин.
+  std::deque<uint32_t> fifo;  ///< Очередь активных вершин.
+
+  /**
+   * @brief Добавляет вершину в список её уровня.
+   */
+  void linkLevel(size_t v) {
+    size_t h = height[v];
+    levelPrev[v] = kNone;
+    levelNext[v] = levelHead[h];
+    if (levelHead[h] != kNone) levelPrev[levelHead[h]] = v;
+    levelHead[h] = v;
+    maxLevel = std::max(maxLevel, h);
+  }
+
+  /**
+   * @brief Удаляет вершину из списка её уровня.
+   */
+  void unlinkLevel(size_t v) {
+    if (levelPrev[v] != kNone) {
+      levelNext[levelPrev[v]] = levelNext[v];
+    } else {
+      levelHead[height[v]] = levelNext[v];
+    }
+    if (levelNext[v] != kNone) levelPrev[levelNext[v]] = levelPrev[v];
+  }
+
+  /**
+   * @brief Делает вершину активной.
+   */
+  void activate(size_t v) {
+    if (rule == PushRelabelRule::Fifo) {
+      fifo.push_back(static_cast<uint32_t>(v));
+    } else {
+      activeBuckets[height[v]].push_back(static_cast<uint32_t>(v));
+      maxActive = std::max(maxActive, height[v]);
+    }
+  }
+
+  /**
+   * @brief Выбирает следующую активную вершину.
+   * @return Индекс вершины или kNone, если активных вершин нет.
+   */
+  size_t selectActive() {
+    if (rule == PushRelabelRule::Fifo) {
+      while (!fifo.empty()) {
+        size_t v = fifo.front();
+        fifo.pop_front();
+        if (excess[v] > 0 && height[v] < n) return v;
+      }
+      return kNone;
+    }
+    while (true) {
+      auto& bucket = activeBuckets[maxActive];
+      while (!bucket.empty()) {
+        size_t v = bucket.back();
+        bucket.pop_back();
+        // Записи, устаревшие после gap или global relabel, пропускаются
+        if (excess[v] > 0 && height[v] == maxActive) return v;
+      }
+      if (maxActive == 0) return kNone;
+      --maxActive;
+    }
+  }
+
+  /**
+   * @brief Проталкивает избыток вершины, поднимая её при необходимости.
+   * @param v Индекс активной вершины.
+   * @return Объём работы на поднятия (для планирования global relabel).
+   */
+  size_t discharge(size_t v) {
+    size_t work = 0;
+    while (excess[v] > 0) {
+      auto arcs = network.getArcs(v);
+      for (; current[v] < arcs.size(); ++current[v]) {
+        uint32_t id = arcs.begin()[current[v]];
+        auto& e = network.getEdge(id);
+        if (e.residual() <= 0 || height[v] != height[e.target] + 1) continue;
+        int delta = std::min(excess[v], e.residual());
+        size_t w = e.target;
+        network.pushFlow(id, delta);
+        excess[v] -= delta;
+        excess[w] += delta;
+        if (excess[w] == delta && w != t) activate(w);
+        if (excess[v] == 0) break;
+      }
+      if (excess[v] == 0) break;
+
+      work += kRelabelWork + arcs.size();
+      if (!relabel(v)) break;
+    }
+    return work;
+  }
+
+  /**
+   * @brief Поднимает вершину и применяет gap heuristic.
+   * @param v Индекс вершины без допустимых дуг.
+   * @return true, если вершина осталась ниже n и может продолжать разгрузку.
+   */
+  bool relabel(size_t v) {
+    size_t oldHeight = height[v];
+    unlinkLevel(v);
+
+    if (levelHead[oldHeight] == kNone) {
+      // Пустой уровень: всё, что выше, больше не достигает стока
+      for (size_t h = oldHeight + 1; h <= maxLevel; ++h) {
+        for (size_t u = levelHead[h]; u != kNone; u = levelNext[u]) {
+          height[u] = n;
+        }
+        levelHead[h] = kNone;
+      }
+      maxLevel = oldHeight == 0 ? 0 : oldHeight - 1;
+      height[v] = n;
+      return false;
+    }
+
+    size_t newHeight = n;
+    auto arcs = network.getArcs(v);
+    for (size_t i = 0; i < arcs.size(); ++i) {
+      const auto& e = network.getEdge(arcs.begin()[i]);
+      if (e.residual() > 0 && height[e.target] + 1 < newHeight) {
+        newHeight = height[e.target] + 1;
+        current[v] = i;
+      }
+    }
+    height[v] = newHeight;
+    if (newHeight >= n) return false;
+    linkLevel(v);
+    return true;
+  }
+
+  /**
+   * @brief Пересчитывает точные высоты обратным BFS от стока.
+   */
+  void globalRelabel() {
+    std::fill(height.begin(), height.end(), n);
+    std::fill(levelHead.begin(), levelHead.end(), kNone);
+    std::fill(current.begin(), current.end(), 0);
+    for (auto& bucket : activeBuckets) bucket.clear();
+    fifo.clear();
+    maxLevel = 0;
+    maxActive = 0;
+
+    std::vector<size_t> queue;
+    queue.reserve(n);
+    queue.push_back(t);
+    height[t] = 0;
+    for (size_t head = 0; head < queue.size(); ++head) {
+      size_t v = queue[head];
+      for (uint32_t id : network.getArcs(v)) {
+        size_t w = network.getEdge(id).target;
+        // Дуга w -> v остаточной сети — это ребро, обратное id
+        if (height[w] != n || w == s) continue;
+        if (network.getEdge(FlowNetwork<GraphType>::reverseEdge(id))
+                .residual() <= 0) {
+          continue;
+        }
+        height[w] = height[v] + 1;
+        queue.push_back(w);
+        linkLevel(w);
+        if (excess[w] > 0) activate(w);
+      }
+    }
+  }
+
+  /**
+   * @brief Превращает максимальный предпоток в поток, возвращая избыток
+   * вершин, отрезанных от стока, обратно в исток.
+   */
+  void returnExcessToSource() {
+    // Высоты — расстояния до истока в остаточной сети
+    std::fill(height.begin(), height.end(), 2 * n);
+    std::fill(current.begin(), current.end(), 0);
+    std::vector<size_t> queue;
+    queue.reserve(n);
+    queue.push_back(s);
+    height[s] = 0;
+    for (size_t head = 0; head < queue.size(); ++head) {
+      size_t v = queue[head];
+      for (uint32_t id : network.getArcs(v)) {
+        size_t w = network.getEdge(id).target;
+        if (height[w] != 2 * n) continue;
+        if (network.getEdge(FlowNetwork<GraphType>::reverseEdge(id))
+                .residual() <= 0) {
+          continue;
+        }
+        height[w] = height[v] + 1;
+        queue.push_back(w);
+      }
+    }
+
+    std::deque<size_t> active;
+    for (size_t v = 0; v < n; ++v) {
+      if (v != s && v != t && excess[v] > 0) active.push_back(v);
+    }
+    while (!active.empty()) {
+      size_t v = active.front();
+      active.pop_front();
+      while (excess[v] > 0) {
+        auto arcs = network.getArcs(v);
+        for (; current[v] < arcs.size() && excess[v] > 0; ++current[v]) {
+          uint32_t id = arcs.begin()[current[v]];
+          auto& e = network.getEdge(id);
+          if (e.residual() <= 0 || height[v] != height[e.target] + 1) continue;
+          int delta = std::min(excess[v], e.residual());
+          size_t w = e.target;
+          network.pushFlow(id, delta);
+          excess[v] -= delta;
+          excess[w] += delta;
+          if (excess[w] == delta && w != s && w != t) active.push_back(w);
+        }
+        if (excess[v] == 0) break;
+
+        size_t newHeight = kNone;
+        for (size_t i = 0; i < arcs.size(); ++i) {
+          const auto& e = network.getEdge(arcs.begin()[i]);
+          if (e.residual() > 0 && height[e.target] + 1 < newHeight) {
+            newHeight = height[e.target] + 1;
+            current[v] = i;
+          }
+        }
+        height[v] = newHeight;
+      }
+    }
+  }
+};
+
+}  // namespace graph
+
+#endif  // PUSH_RELABEL_H
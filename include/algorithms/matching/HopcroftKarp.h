@@ -0,0 +1,398 @@
+#ifndef HOPCROFT_KARP_H
+#define HOPCROFT_KARP_H
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "DirectedGraph.h"
+#include "UndirectedGraph.h"
+
+namespace graph {
+
+/**
+ * @class BipartiteView
+ * @brief Двудольное представление графа в формате CSR.
+ *
+ * Вершины левой и правой долей нумеруются плотными индексами, рёбра из
+ * левой доли хранятся одним массивом номеров правых вершин со смещениями по
+ * левым вершинам.
+ *
+ * @tparam VertexType Тип вершины.
+ */
+template <typename VertexType = Vertex>
+class BipartiteView {
+ public:
+  /**
+   * @brief Строит представление по списку рёбер между индексами долей.
+   *
+   * @param leftVertices Вершины левой доли.
+   * @param rightVertices Вершины правой доли.
+   * @param edges Рёбра: пары (индекс левой вершины, индекс правой вершины).
+   * @throws std::out_of_range Если индекс ребра выходит за пределы доли.
+   */
+  BipartiteView(std::vector<VertexType> leftVertices,
+                std::vector<VertexType> rightVertices,
+                const std::vector<std::pair<uint32_t, uint32_t>>& edges)
+      : left(std::move(leftVertices)), right(std::move(rightVertices)) {
+    offsets.assign(left.size() + 1, 0);
+    for (const auto& [u, v] : edges) {
+      if (u >= left.size() || v >= right.size()) {
+        throw std::out_of_range("Vertex not found");
+      }
+      ++offsets[u + 1];
+    }
+    for (size_t u = 0; u < left.size(); ++u) {
+      offsets[u + 1] += offsets[u];
+    }
+    adjacency.resize(edges.size());
+    std::vector<size_t> cursor(offsets.begin(), offsets.end() - 1);
+    for (const auto& [u, v] : edges) {
+      adjacency[cursor[u]++] = v;
+    }
+  }
+
+  /**
+   * @brief Строит представление ориентированного графа.
+   *
+   * Начала рёбер образуют левую долю, концы — правую; вершина, у которой
+   * есть и входящие, и исходящие рёбра, попадает в обе доли.
+   *
+   * @param graph Ориентированный граф.
+   */
+  template <typename EdgeType>
+  explicit BipartiteView(const DirectedGraph<VertexType, EdgeType>& graph)
+      : BipartiteView(fromEdges(graph.getEdges())) {}
+
+  /**
+   * @brief Строит представление неориентированного графа.
+   *
+   * Доли находятся раскраской в два цвета обходом в ширину; в каждой
+   * компоненте связности вершина, встреченная первой, попадает в левую долю.
+   *
+   * @param graph Неориентированный граф.
+   * @throws std::invalid_argument Если граф не двудольный.
+   */
+  template <typename EdgeType>
+  explicit BipartiteView(const UndirectedGraph<VertexType, EdgeType>& graph)
+      : BipartiteView(fromColoring(graph)) {}
+
+  /**
+   * @brief Возвращает число вершин левой доли.
+   */
+  size_t leftCount() const { return left.size(); }
+
+  /**
+   * @brief Возвращает число вершин правой доли.
+   */
+  size_t rightCount() const { return right.size(); }
+
+  /**
+   * @brief Возвращает число рёбер.
+   */
+  size_t edgeCount() const { return adjacency.size(); }
+
+  /**
+   * @brief Возвращает вершину левой доли по индексу.
+   */
+  const VertexType& getLeft(size_t u) const { return left[u]; }
+
+  /**
+   * @brief Возвращает вершину правой доли по индексу.
+   */
+  const VertexType& getRight(size_t v) const { return right[v]; }
+
+  /**
+   * @brief Возвращает начало соседей левой вершины в массиве смежности.
+   */
+  size_t begin(size_t u) const { return offsets[u]; }
+
+  /**
+   * @brief Возвращает конец соседей левой вершины в массиве смежности.
+   */
+  size_t end(size_t u) const { return offsets[u + 1]; }
+
+  /**
+   * @brief Возвращает правую вершину по позиции в массиве смежности.
+   */
+  uint32_t neighbor(size_t position) const { return adjacency[position]; }
+
+ private:
+  std::vector<VertexType> left;    ///< Вершины левой доли.
+  std::vector<VertexType> right;   ///< Вершины правой доли.
+  std::vector<size_t> offsets;     ///< Начало соседей каждой левой вершины.
+  std::vector<uint32_t> adjacency;  ///< Индексы правых соседей.
+
+  /**
+   * @brief Нумерует концы ориентированных рёбер по долям.
+   */
+  template <typename Edges>
+  static BipartiteView fromEdges(const Edges& graphEdges) {
+    std::vector<VertexType> leftVertices;
+    std::vector<VertexType> rightVertices;
+    std::unordered_map<VertexType, uint32_t> leftIndex;
+    std::unordered_map<VertexType, uint32_t> rightIndex;
+    std::vector<std::pair<uint32_t, uint32_t>> edges;
+    edges.reserve(graphEdges.size());
+    for (const auto& e : graphEdges) {
+      auto [l, newLeft] = leftIndex.emplace(
+          e.source, static_cast<uint32_t>(leftVertices.size()));
+      if (newLeft) leftVertices.push_back(e.source);
+      auto [r, newRight] = rightIndex.emplace(
+          e.target, static_cast<uint32_t>(rightVertices.size()));
+      if (newRight) rightVertices.push_back(e.target);
+      edges.emplace_back(l->second, r->second);
+    }
+    return BipartiteView(std::move(leftVertices), std::move(rightVertices),
+                         edges);
+  }
+
+  /**
+   * @brief Раскрашивает неориентированный граф в два цвета.
+   * @throws std::invalid_argument Если найдено ребро внутри одной доли.
+   */
+  template <typename EdgeType>
+  static BipartiteView fromColoring(
+      const UndirectedGraph<VertexType, EdgeType>& graph) {
+    const auto& vertices = graph.getVertices();
+    std::unordered_map<VertexType, uint32_t> index;
+    for (const auto& v : vertices) {
+      index.emplace(v, static_cast<uint32_t>(index.size()));
+    }
+    const size_t n = vertices.size();
+
+    // Рёбра хранятся в обоих направлениях, поэтому CSR симметричен
+    std::vector<size_t> start(n + 1, 0);
+    for (const auto& e : graph.getEdges()) {
+      ++start[index.at(e.source) + 1];
+    }
+    for (size_t v = 0; v < n; ++v) {
+      start[v + 1] += start[v];
+    }
+    std::vector<uint32_t> neighbors(start[n]);
+    std::vector<size_t> cursor(start.begin(), start.end() - 1);
+    for (const auto& e : graph.getEdges()) {
+      neighbors[cursor[index.at(e.source)]++] = index.at(e.target);
+    }
+
+    constexpr uint8_t kUncolored = 2;
+    std::vector<uint8_t> color(n, kUncolored);
+    std::vector<uint32_t> queue;
+    queue.reserve(n);
+    for (size_t root = 0; root < n; ++root) {
+      if (color[root] != kUncolored) continue;
+      color[root] = 0;
+      queue.assign(1, static_cast<uint32_t>(root));
+      for (size_t head = 0; head < queue.size(); ++head) {
+        uint32_t u = queue[head];
+        for (size_t i = start[u]; i < start[u + 1]; ++i) {
+          uint32_t w = neighbors[i];
+          if (color[w] == color[u]) {
+            throw std::invalid_argument("Graph is not bipartite");
+          }
+          if (color[w] == kUncolored) {
+            color[w] = color[u] ^ 1;
+            queue.push_back(w);
+          }
+        }
+      }
+    }
+
+    std::vector<uint32_t> side(n);
+    std::vector<VertexType> leftVertices;
+    std::vector<VertexType> rightVertices;
+    for (size_t v = 0; v < n; ++v) {
+      auto& part = color[v] == 0 ? leftVertices : rightVertices;
+      side[v] = static_cast<uint32_t>(part.size());
+      part.push_back(vertices[v]);
+    }
+    std::vector<std::pair<uint32_t, uint32_t>> edges;
+    edges.reserve(start[n] / 2);
+    for (size_t u = 0; u < n; ++u) {
+      if (color[u] != 0) continue;
+      for (size_t i = start[u]; i < start[u + 1]; ++i) {
+        edges.emplace_back(side[u], side[neighbors[i]]);
+      }
+    }
+    return BipartiteView(std::move(leftVertices), std::move(rightVertices),
+                         edges);
+  }
+};
+
+/**
+ * @class HopcroftKarp
+ * @brief Наибольшее паросочетание в двудольном графе алгоритмом
+ * Хопкрофта–Карпа.
+ *
+ * Каждая фаза строит обходом в ширину от свободных левых вершин слои
+ * кратчайших чередующихся путей и останавливается на первом слое, где
+ * встречается свободная правая вершина. Затем обход в глубину с явным стеком
+ * и текущими дугами находит максимальное по включению множество
+ * непересекающихся кратчайших увеличивающих путей. Фаз O(√V), поэтому общее
+ * время — O(E√V). Все состояния — плоские массивы по индексам долей.
+ *
+ * @tparam VertexType Тип вершины.
+ */
+template <typename VertexType = Vertex>
+class HopcroftKarp {
+ public:
+  /**
+   * @brief Конструктор.
+   * @param view Двудольное представление графа; должно жить дольше решателя.
+   */
+  explicit HopcroftKarp(const BipartiteView<VertexType>& view) : view(view) {}
+
+  /**
+   * @brief Вычисляет наибольшее паросочетание.
+   *
+   * @param greedyWarmStart Начать с жадного паросочетания: каждая левая
+   * вершина берёт первого свободного соседа. Обычно сокращает число фаз.
+   * @return Размер паросочетания.
+   */
+  size_t computeMaxMatching(bool greedyWarmStart = true) {
+    matchLeft.assign(view.leftCount(), kFree);
+    matchRight.assign(view.rightCount(), kFree);
+    size_t matched = 0;
+    if (greedyWarmStart) {
+      for (size_t u = 0; u < view.leftCount(); ++u) {
+        for (size_t i = view.begin(u); i < view.end(u); ++i) {
+          uint32_t v = view.neighbor(i);
+          if (matchRight[v] == kFree) {
+            matchLeft[u] = v;
+            matchRight[v] = static_cast<uint32_t>(u);
+            ++matched;
+            break;
+          }
+        }
+      }
+    }
+
+    while (buildLayers()) {
+      cursor.resize(view.leftCount());
+      for (size_t u = 0; u < view.leftCount(); ++u) {
+        cursor[u] = view.begin(u);
+      }
+      for (size_t u = 0; u < view.leftCount(); ++u) {
+        if (matchLeft[u] == kFree && augment(static_cast<uint32_t>(u))) {
+          ++matched;
+        }
+      }
+    }
+    return matched;
+  }
+
+  /**
+   * @brief Возвращает пары паросочетания (левая вершина, правая вершина).
+   */
+  std::vector<std::pair<VertexType, VertexType>> getMatching() const {
+    std::vector<std::pair<VertexType, VertexType>> result;
+    for (size_t u = 0; u < matchLeft.size(); ++u) {
+      if (matchLeft[u] != kFree) {
+        result.emplace_back(view.getLeft(u), view.getRight(matchLeft[u]));
+      }
+    }
+    return result;
+  }
+
+  /**
+   * @brief Возвращает пары левых вершин по индексам.
+   * @return Индекс правой вершины для каждой левой или kFree.
+   */
+  const std::vector<uint32_t>& getMatchLeft() const { return matchLeft; }
+
+  /**
+   * @brief Возвращает пары правых вершин по индексам.
+   * @return Индекс левой вершины для каждой правой или kFree.
+   */
+  const std::vector<uint32_t>& getMatchRight() const { return matchRight; }
+
+  static constexpr uint32_t kFree =
+      std::numeric_limits<uint32_t>::max();  ///< Вершина без пары.
+
+ private:
+  static constexpr uint32_t kUnreached =
+      std::numeric_limits<uint32_t>::max();  ///< Вершина вне слоёв.
+
+  const BipartiteView<VertexType>& view;  ///< Двудольное представление.
+  std::vector<uint32_t> matchLeft;   ///< Пара каждой левой вершины.
+  std::vector<uint32_t> matchRight;  ///< Пара каждой правой вершины.
+  std::vector<uint32_t> layer;       ///< Слой левой вершины.
+  std::vector<size_t> cursor;        ///< Текущая дуга левой вершины.
+  std::vector<uint32_t> queue;       ///< Очередь BFS.
+  std::vector<uint32_t> stack;       ///< Левые вершины текущего пути.
+  uint32_t freeLayer = 0;  ///< Длина кратчайшего увеличивающего пути.
+
+  /**
+   * @brief Строит слои кратчайших чередующихся путей.
+   * @return true, если достижима свободная правая вершина.
+   */
+  bool buildLayers() {
+    layer.assign(view.leftCount(), kUnreached);
+    queue.clear();
+    for (size_t u = 0; u < view.leftCount(); ++u) {
+      if (matchLeft[u] == kFree) {
+        layer[u] = 0;
+        queue.push_back(static_cast<uint32_t>(u));
+      }
+    }
+    freeLayer = kUnreached;
+    for (size_t head = 0; head < queue.size(); ++head) {
+      uint32_t u = queue[head];
+      // Слои не короче найденного пути не нужны
+      if (layer[u] + 1 >= freeLayer) break;
+      for (size_t i = view.begin(u); i < view.end(u); ++i) {
+        uint32_t w = matchRight[view.neighbor(i)];
+        if (w == kFree) {
+          freeLayer = layer[u] + 1;
+        } else if (layer[w] == kUnreached) {
+          layer[w] = layer[u] + 1;
+          queue.push_back(w);
+        }
+      }
+    }
+    return freeLayer != kUnreached;
+  }
+
+  /**
+   * @brief Ищет кратчайший увеличивающий путь из свободной левой вершины и
+   * чередует паросочетание вдоль него.
+   * @return true, если путь найден.
+   */
+  bool augment(uint32_t root) {
+    stack.assign(1, root);
+    while (!stack.empty()) {
+      uint32_t u = stack.back();
+      if (cursor[u] == view.end(u)) {
+        // Тупик: вершина больше не участвует в этой фазе
+        layer[u] = kUnreached;
+        stack.pop_back();
+        if (!stack.empty()) ++cursor[stack.back()];
+        continue;
+      }
+      uint32_t w = matchRight[view.neighbor(cursor[u])];
+      if (w == kFree) {
+        if (layer[u] + 1 == freeLayer) break;
+      } else if (layer[w] == layer[u] + 1 && layer[w] < freeLayer) {
+        stack.push_back(w);
+        continue;
+      }
+      ++cursor[u];
+    }
+    if (stack.empty()) return false;
+
+    // Каждая левая вершина пути берёт правую вершину своей текущей дуги
+    for (uint32_t u : stack) {
+      uint32_t v = view.neighbor(cursor[u]);
+      matchLeft[u] = v;
+      matchRight[v] = u;
+    }
+    return true;
+  }
+};
+
+}  // namespace graph
+
+#endif  // HOPCROFT_KARP_H
@@ -0,0 +1,267 @@
+#ifndef PARALLEL_FOR_H
+#define PARALLEL_FOR_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace graph {
+
+/**
+ * @brief Возвращает число потоков, используемое по умолчанию.
+ * @return Количество аппаратных потоков (не меньше 1).
+ */
+inline size_t defaultThreadCount() {
+  unsigned count = std::thread::hardware_concurrency();
+  return count == 0 ? 1 : count;
+}
+
+/**
+ * @brief Параллельно выполняет тело цикла для индексов [begin, end).
+ *
+ * Индексы раздаются потокам блоками по grain через атомарный счётчик, что
+ * выравнивает нагрузку при неравномерной стоимости итераций. Первое
+ * исключение, выброшенное телом цикла, пробрасывается в вызывающий поток.
+ *
+ * @tparam Function Тип тела цикла, вызываемого как body(i).
+ * @param begin Первый индекс.
+ * @param end Индекс за последним.
+ * @param threadCount Число потоков (0 или 1 — последовательное выполнение).
+ * @param body Тело цикла.
+ * @param grain Размер блока индексов, выдаваемого потоку за раз.
+ */
+template <typename Function>
+void parallelFor(size_t begin, size_t end, size_t threadCount, Function&& body,
+                 size_t grain = 64) {
+  if (begin >= end) return;
+  grain = std::max<size_t>(grain, 1);
+  size_t blocks = (end - begin + grain - 1) / grain;
+  threadCount = std::min(threadCount, blocks);
+  if (threadCount <= 1) {
+    for (size_t i = begin; i < end; ++i) {
+      body(i);
+    }
+    return;
+  }
+
+  std::atomic<size_t> next{begin};
+  std::exception_ptr error;
+  std::mutex errorMutex;
+
+  auto worker = [&]() {
+    try {
+      for (;;) {
+        size_t first = next.fetch_add(grain, std::memory_order_relaxed);
+        if (first >= end) break;
+        size_t last = std::min(end, first + grain);
+        for (size_t i = first; i < last; ++i) {
+          body(i);
+        }
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(errorMutex);
+      if (!error) error = std::current_exception();
+      next.store(end, std::memory_order_relaxed);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(threadCount - 1);
+  for (size_t t = 1; t < threadCount; ++t) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+/**
+ * @brief Постоянная группа потоков для многофазных алгоритмов.
+ *
+ * Потоки создаются один раз в конструкторе и между фазами спят на условной
+ * переменной, поэтому запуск фазы стоит одной синхронизации, а не создания
+ * и ожидания потоков, как у parallelFor. Вызывающий поток участвует в
+ * каждой фазе как участник 0. Первое исключение фазы пробрасывается в
+ * вызывающий поток после её завершения.
+ */
+class WorkerTeam {
+ public:
+  /**
+   * @brief Запускает потоки группы.
+   * @param threadCount Число участников вместе с вызывающим потоком.
+   */
+  explicit WorkerTeam(size_t threadCount = defaultThreadCount())
+      : count(std::max<size_t>(threadCount, 1)) {
+    workers.reserve(count - 1);
+    for (size_t worker = 1; worker < count; ++worker) {
+      workers.emplace_back([this, worker] { loop(worker); });
+    }
+  }
+
+  WorkerTeam(const WorkerTeam&) = delete;
+  WorkerTeam& operator=(const WorkerTeam&) = delete;
+
+  /**
+   * @brief Останавливает и дожидается потоки группы.
+   */
+  ~WorkerTeam() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+    wake.notify_all();
+    for (auto& thread : workers) {
+      thread.join();
+    }
+  }
+
+  /**
+   * @brief Возвращает число участников.
+   */
+  size_t size() const { return count; }
+
+  /**
+   * @brief Выполняет фазу: body(worker) на каждом участнике.
+   * @tparam Function Тип тела фазы.
+   * @param body Тело фазы.
+   */
+  template <typename Function>
+  void run(Function&& body) {
+    using Body = std::remove_reference_t<Function>;
+    if (count == 1) {
+      body(size_t{0});
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      context = const_cast<void*>(static_cast<const void*>(&body));
+      invoke = [](void* target, size_t worker) {
+        (*static_cast<Body*>(target))(worker);
+      };
+      error = nullptr;
+      pending = count - 1;
+      ++generation;
+    }
+    wake.notify_all();
+    execute(0);
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [&] { return pending == 0; });
+    if (error) std::rethrow_exception(error);
+  }
+
+  /**
+   * @brief Параллельный цикл на потоках группы: body(i, worker) для
+   * индексов [begin, end), раздаваемых блоками по grain.
+   * @tparam Function Тип тела цикла.
+   * @param begin Первый индекс.
+   * @param end Индекс за последним.
+   * @param body Тело цикла.
+   * @param grain Размер блока индексов.
+   */
+  template <typename Function>
+  void forEach(size_t begin, size_t end, Function&& body, size_t grain = 64) {
+    if (begin >= end) return;
+    grain = std::max<size_t>(grain, 1);
+    std::atomic<size_t> next{begin};
+    run([&](size_t worker) {
+      try {
+        for (;;) {
+          size_t first = next.fetch_add(grain, std::memory_order_relaxed);
+          if (first >= end) break;
+          size_t last = std::min(end, first + grain);
+          for (size_t i = first; i < last; ++i) {
+            body(i, worker);
+          }
+        }
+      } catch (...) {
+        next.store(end, std::memory_order_relaxed);
+        throw;
+      }
+    });
+  }
+
+ private:
+  size_t count;                      ///< Число участников.
+  std::vector<std::thread> workers;  ///< Потоки участников 1..count-1.
+  std::mutex mutex;                  ///< Защищает состояние фазы.
+  std::condition_variable wake;      ///< Сигнал начала фазы или остановки.
+  std::condition_variable done;      ///< Сигнал завершения фазы.
+  void* context = nullptr;           ///< Тело текущей фазы.
+  void (*invoke)(void*, size_t) = nullptr;  ///< Вызов тела фазы.
+  std::exception_ptr error;  ///< Первое исключение фазы.
+  size_t pending = 0;        ///< Потоки, ещё не закончившие фазу.
+  size_t generation = 0;     ///< Номер фазы.
+  bool stopping = false;     ///< Группа останавливается.
+
+  /**
+   * @brief Цикл потока: ждёт фазу, выполняет её и отчитывается.
+   */
+  void loop(size_t worker) {
+    size_t seen = 0;
+    for (;;) {
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        wake.wait(lock, [&] { return stopping || generation != seen; });
+        if (stopping) return;
+        seen = generation;
+      }
+      execute(worker);
+      std::lock_guard<std::mutex> lock(mutex);
+      if (--pending == 0) done.notify_one();
+    }
+  }
+
+  /**
+   * @brief Выполняет тело фазы, запоминая первое исключение.
+   */
+  void execute(size_t worker) {
+    try {
+      invoke(context, worker);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (!error) error = std::current_exception();
+    }
+  }
+};
+
+/**
+ * @brief Раскрывает фронт обхода на потоках группы и собирает следующий.
+ *
+ * Вершины фронта раздаются блоками по grain; expand(v, worker) складывает
+ * вершины следующего фронта в next[worker]. После раскрытия frontier
+ * заменяется объединением списков next, а сами списки очищаются. Порядок
+ * вершин в новом фронте зависит от расписания потоков.
+ *
+ * @tparam Expand Тип функции раскрытия вершины.
+ * @param team Группа потоков.
+ * @param frontier Текущий фронт; заменяется следующим.
+ * @param next Списки следующего фронта по потокам (team.size() штук).
+ * @param expand Функция раскрытия вершины.
+ * @param grain Размер блока вершин.
+ */
+template <typename Expand>
+void advanceFrontier(WorkerTeam& team, std::vector<uint32_t>& frontier,
+                     std::vector<std::vector<uint32_t>>& next, Expand&& expand,
+                     size_t grain = 64) {
+  team.forEach(
+      0, frontier.size(),
+      [&](size_t i, size_t worker) { expand(frontier[i], worker); }, grain);
+  frontier.clear();
+  for (auto& list : next) {
+    frontier.insert(frontier.end(), list.begin(), list.end());
+    list.clear();
+  }
+}
+
+}  // namespace graph
+
+#endif  // PARALLEL_FOR_H
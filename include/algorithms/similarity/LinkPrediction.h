@@ -0,0 +1,159 @@
+#ifndef LINK_PREDICTION_H
+#define LINK_PREDICTION_H
+
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../parallel/ParallelFor.h"
+#include "AdjacencyListGraph.h"
+#include "SortedSetIntersection.h"
+
+namespace graph {
+
+/**
+ * @brief Оценки близости пары вершин для предсказания связей.
+ */
+struct LinkScores {
+  size_t commonNeighbors = 0;  ///< Число общих соседей.
+  double jaccard = 0;     ///< |N(u) ∩ N(v)| / |N(u) ∪ N(v)|.
+  double adamicAdar = 0;  ///< Сумма 1 / ln(deg(w)) по общим соседям w.
+};
+
+/**
+ * @brief Проверяет, что граф хранит отсортированные списки соседей.
+ * @throws std::logic_error Если режим отсортированных соседей выключен.
+ */
+template <typename VertexType, typename EdgeType>
+void requireSortedNeighbors(
+    const AdjacencyListGraph<VertexType, EdgeType>& graph) {
+  if (!graph.hasSortedNeighbors()) {
+    throw std::logic_error("Neighbor lists are not sorted");
+  }
+}
+
+/**
+ * @brief Число общих соседей двух вершин.
+ * @param graph Граф с отсортированными списками соседей.
+ * @param u Первая вершина.
+ * @param v Вторая вершина.
+ * @return |N(u) ∩ N(v)| по исходящим спискам смежности.
+ * @throws std::logic_error Если списки соседей не отсортированы.
+ */
+template <typename VertexType, typename EdgeType>
+size_t commonNeighborCount(
+    const AdjacencyListGraph<VertexType, EdgeType>& graph, const VertexType& u,
+    const VertexType& v) {
+  requireSortedNeighbors(graph);
+  return countCommonSorted(graph.getNeighbors(u), graph.getNeighbors(v));
+}
+
+/**
+ * @brief Коэффициент Жаккара для двух вершин.
+ * @param graph Граф с отсортированными списками соседей.
+ * @param u Первая вершина.
+ * @param v Вторая вершина.
+ * @return Отношение числа общих соседей к размеру объединения (0, если оба
+ * списка пусты).
+ * @throws std::logic_error Если списки соседей не отсортированы.
+ */
+template <typename VertexType, typename EdgeType>
+double jaccardCoefficient(const AdjacencyListGraph<VertexType, EdgeType>& graph,
+                          const VertexType& u, const VertexType& v) {
+  requireSortedNeighbors(graph);
+  const auto& neighborsU = graph.getNeighbors(u);
+  const auto& neighborsV = graph.getNeighbors(v);
+  size_t common = countCommonSorted(neighborsU, neighborsV);
+  size_t united = neighborsU.size() + neighborsV.size() - common;
+  if (united == 0) return 0.0;
+  return static_cast<double>(common) / static_cast<double>(united);
+}
+
+/**
+ * @brief Индекс Адамик-Адара для двух вершин.
+ *
+ * Общие соседи со степенью не больше 1 не дают вклада, так как ln(1) = 0.
+ *
+ * @param graph Граф с отсортированными списками соседей.
+ * @param u Первая вершина.
+ * @param v Вторая вершина.
+ * @return Сумма 1 / ln(deg(w)) по общим соседям w.
+ * @throws std::logic_error Если списки соседей не отсортированы.
+ */
+template <typename VertexType, typename EdgeType>
+double adamicAdarIndex(const AdjacencyListGraph<VertexType, EdgeType>& graph,
+                       const VertexType& u, const VertexType& v) {
+  requireSortedNeighbors(graph);
+  double score = 0;
+  forEachCommonSorted(graph.getNeighbors(u), graph.getNeighbors(v),
+                      [&](const VertexType& w) {
+                        size_t degree = graph.getNeighbors(w).size();
+                        if (degree > 1) {
+                          score += 1.0 / std::log(static_cast<double>(degree));
+                        }
+                      });
+  return score;
+}
+
+/**
+ * @brief Вычисляет все оценки близости для пары вершин.
+ * @param graph Граф с отсортированными списками соседей.
+ * @param u Первая вершина.
+ * @param v Вторая вершина.
+ * @return Число общих соседей, коэффициент Жаккара и индекс Адамик-Адара.
+ * @throws std::logic_error Если списки соседей не отсортированы.
+ */
+template <typename VertexType, typename EdgeType>
+LinkScores computeLinkScores(
+    const AdjacencyListGraph<VertexType, EdgeType>& graph, const VertexType& u,
+    const VertexType& v) {
+  requireSortedNeighbors(graph);
+  const auto& neighborsU = graph.getNeighbors(u);
+  const auto& neighborsV = graph.getNeighbors(v);
+
+  // Число общих соседей считает векторное пересечение; поэлементный проход
+  // нужен только индексу Адамик-Адара и только при непустом пересечении
+  LinkScores scores;
+  scores.commonNeighbors = countCommonSorted(neighborsU, neighborsV);
+  if (scores.commonNeighbors != 0) {
+    forEachCommonSorted(neighborsU, neighborsV, [&](const VertexType& w) {
+      size_t degree = graph.getNeighbors(w).size();
+      if (degree > 1) {
+        scores.adamicAdar += 1.0 / std::log(static_cast<double>(degree));
+      }
+    });
+  }
+  size_t united =
+      neighborsU.size() + neighborsV.size() - scores.commonNeighbors;
+  if (united != 0) {
+    scores.jaccard = static_cast<double>(scores.commonNeighbors) /
+                     static_cast<double>(united);
+  }
+  return scores;
+}
+
+/**
+ * @brief Параллельно вычисляет оценки близости для набора пар вершин.
+ * @param graph Граф с отсортированными списками соседей.
+ * @param pairs Пары вершин.
+ * @param threadCount Число потоков.
+ * @return Оценки в порядке пар.
+ * @throws std::logic_error Если списки соседей не отсортированы.
+ */
+template <typename VertexType, typename EdgeType>
+std::vector<LinkScores> computeLinkScores(
+    const AdjacencyListGraph<VertexType, EdgeType>& graph,
+    const std::vector<std::pair<VertexType, VertexType>>& pairs,
+    size_t threadCount = defaultThreadCount()) {
+  requireSortedNeighbors(graph);
+  std::vector<LinkScores> scores(pairs.size());
+  parallelFor(0, pairs.size(), threadCount, [&](size_t i) {
+    scores[i] = computeLinkScores(graph, pairs[i].first, pairs[i].second);
+  }, 1024);
+  return scores;
+}
+
+}  // namespace graph
+
+#endif  // LINK_PREDICTION_H
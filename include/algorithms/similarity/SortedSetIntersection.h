@@ -0,0 +1,163 @@
+#ifndef SORTED_SET_INTERSECTION_H
+#define SORTED_SET_INTERSECTION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace graph {
+
+/**
+ * @brief Скалярное слияние двух отсортированных массивов без повторов.
+ * @param a Первый массив.
+ * @param sizeA Размер первого массива.
+ * @param b Второй массив.
+ * @param sizeB Размер второго массива.
+ * @return Число общих элементов.
+ */
+inline size_t intersectSortedCountScalar(const int32_t* a, size_t sizeA,
+                                         const int32_t* b, size_t sizeB) {
+  size_t count = 0;
+  size_t i = 0;
+  size_t j = 0;
+  while (i < sizeA && j < sizeB) {
+    // Без ветвлений: сдвигаем тот указатель, чей элемент не больше.
+    int32_t x = a[i];
+    int32_t y = b[j];
+    count += x == y;
+    i += x <= y;
+    j += y <= x;
+  }
+  return count;
+}
+
+/**
+ * @brief Векторизованный подсчёт пересечения двух отсортированных массивов.
+ *
+ * Массивы сравниваются блоками: блок a сравнивается со всеми циклическими
+ * сдвигами блока b, после чего продвигается блок с меньшим максимумом.
+ * Используется AVX2 (по 8 элементов) или SSE2 (по 4 элемента) в зависимости от
+ * флагов компиляции, хвосты обрабатываются скалярным слиянием.
+ *
+ * @param a Первый массив, отсортированный по возрастанию без повторов.
+ * @param sizeA Размер первого массива.
+ * @param b Второй массив, отсортированный по возрастанию без повторов.
+ * @param sizeB Размер второго массива.
+ * @return Число общих элементов.
+ */
+inline size_t intersectSortedCount(const int32_t* a, size_t sizeA,
+                                   const int32_t* b, size_t sizeB) {
+  size_t count = 0;
+  size_t i = 0;
+  size_t j = 0;
+
+#if defined(__AVX2__)
+  const __m256i rotate = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+  while (i + 8 <= sizeA && j + 8 <= sizeB) {
+    __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+    __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + j));
+    __m256i match = _mm256_cmpeq_epi32(va, vb);
+    for (int r = 1; r < 8; ++r) {
+      vb = _mm256_permutevar8x32_epi32(vb, rotate);
+      match = _mm256_or_si256(match, _mm256_cmpeq_epi32(va, vb));
+    }
+    count += __builtin_popcount(
+        _mm256_movemask_ps(_mm256_castsi256_ps(match)));
+    int32_t maxA = a[i + 7];
+    int32_t maxB = b[j + 7];
+    i += maxA <= maxB ? 8 : 0;
+    j += maxB <= maxA ? 8 : 0;
+  }
+#elif defined(__SSE2__)
+  while (i + 4 <= sizeA && j + 4 <= sizeB) {
+    __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+    __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j));
+    __m128i rot1 = _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1));
+    __m128i rot2 = _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2));
+    __m128i rot3 = _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3));
+    __m128i match = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi32(va, vb), _mm_cmpeq_epi32(va, rot1)),
+        _mm_or_si128(_mm_cmpeq_epi32(va, rot2), _mm_cmpeq_epi32(va, rot3)));
+    count += __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(match)));
+    int32_t maxA = a[i + 3];
+    int32_t maxB = b[j + 3];
+    i += maxA <= maxB ? 4 : 0;
+    j += maxB <= maxA ? 4 : 0;
+  }
+#endif
+
+  return count + intersectSortedCountScalar(a + i, sizeA - i, b + j, sizeB - j);
+}
+
+/**
+ * @brief Подсчёт общих вершин двух списков, отсортированных по id.
+ *
+ * Если тип вершины по представлению совпадает с 32-битным id, используется
+ * векторизованное пересечение, иначе — скалярное слияние по полю id.
+ *
+ * @tparam Range Непрерывный диапазон вершин (std::vector, NeighborRange).
+ * @param a Первый список.
+ * @param b Второй список.
+ * @return Число общих вершин.
+ */
+template <typename Range>
+size_t countCommonSorted(const Range& a, const Range& b) {
+  using VertexType = std::decay_t<decltype(*a.data())>;
+  if constexpr (std::is_standard_layout_v<VertexType> &&
+                sizeof(VertexType) == sizeof(int32_t) &&
+                std::is_same_v<decltype(VertexType::id), int>) {
+    return intersectSortedCount(reinterpret_cast<const int32_t*>(a.data()),
+                                a.size(),
+                                reinterpret_cast<const int32_t*>(b.data()),
+                                b.size());
+  } else {
+    size_t count = 0;
+    size_t i = 0;
+    size_t j = 0;
+    while (i < a.size() && j < b.size()) {
+      if (a[i].id < b[j].id) {
+        ++i;
+      } else if (b[j].id < a[i].id) {
+        ++j;
+      } else {
+        ++count;
+        ++i;
+        ++j;
+      }
+    }
+    return count;
+  }
+}
+
+/**
+ * @brief Обходит общие вершины двух списков, отсортированных по id.
+ * @tparam Range Непрерывный диапазон вершин (std::vector, NeighborRange).
+ * @tparam Function Тип обработчика, вызываемого как f(vertex).
+ * @param a Первый список.
+ * @param b Второй список.
+ * @param f Обработчик общей вершины.
+ */
+template <typename Range, typename Function>
+void forEachCommonSorted(const Range& a, const Range& b, Function&& f) {
+  size_t i = 0;
+  size_t j = 0;
+  while (i < a.size() && j < b.size()) {
+    if (a[i].id < b[j].id) {
+      ++i;
+    } else if (b[j].id < a[i].id) {
+      ++j;
+    } else {
+      f(a[i]);
+      ++i;
+      ++j;
+    }
+  }
+}
+
+}  // namespace graph
+
+#endif  // SORTED_SET_INTERSECTION_H
@@ -3,19 +3,26 @@
 
 #include <unordered_map>
 
+#include "FlatAdjacencyStore.h"
 #include "Graph.h"
 
 namespace graph {
 
 /**
  * @brief Класс, реализующий граф на основе списка смежности.
+ *
+ * Списки смежности хранятся в плоской хэш-таблице с открытой адресацией и
+ * общим массивом соседей (см. FlatAdjacencyStore).
+ *
  * @tparam VertexType Тип вершины (по умолчанию Vertex).
  * @tparam EdgeType Тип ребра (по умолчанию Edge).
  */
 template <typename VertexType = Vertex, typename EdgeType = Edge>
 class AdjacencyListGraph : public Graph<VertexType, EdgeType> {
- public:
-  std::unordered_map<VertexType, std::vector<VertexType>> adjacencyList;  ///< Список смежности.
+ private:
+  FlatAdjacencyStore<VertexType> adjacencyList;  ///< Список смежности.
+  /// Хранятся ли списки соседей по возрастанию id.
+  bool sortedNeighbors = false;
 
  public:
   /**
@@ -23,6 +30,26 @@ class AdjacencyListGraph : public Graph<VertexType, EdgeType> {
    */
   AdjacencyListGraph() : Graph<VertexType, EdgeType>(){};
 
+  /**
+   * @brief Конструктор с выбором режима хранения соседей.
+   * @param sortedNeighbors Если true, списки соседей поддерживаются
+   * отсортированными по id, и hasEdge работает бинарным поиском.
+   */
+  explicit AdjacencyListGraph(bool sortedNeighbors)
+      : Graph<VertexType, EdgeType>(), sortedNeighbors(sortedNeighbors){};
+
+  /**
+   * @brief Конструктор с источником памяти.
+   * @param resource Источник памяти для вершин, рёбер и списков смежности;
+   * должен жить дольше графа.
+   * @param sortedNeighbors Поддерживать ли списки соседей отсортированными.
+   */
+  explicit AdjacencyListGraph(std::pmr::memory_resource* resource,
+                              bool sortedNeighbors = false)
+      : Graph<VertexType, EdgeType>(resource),
+        adjacencyList(resource),
+        sortedNeighbors(sortedNeighbors){};
+
   /**
    * @brief Деструктор по умолчанию.
    */
@@ -59,7 +86,7 @@ class AdjacencyListGraph : public Graph<VertexType, EdgeType> {
    * @param vertexid Идентификатор вершины.
    * @return Итератор по соседям вершины.
    */
-  typename std::vector<VertexType>::iterator getNeighborsIterator(
+  typename std::pmr::vector<VertexType>::iterator getNeighborsIterator(
       const VertexType& vertexid) override;
 
   /**
@@ -68,15 +95,15 @@ class AdjacencyListGraph : public Graph<VertexType, EdgeType> {
    * @param filter Функция-фильтр для соседей.
    * @return Итератор по соседям вершины, удовлетворяющим фильтру.
    */
-  typename std::vector<VertexType>::iterator getFilteredNeighborsIterator(
+  typename std::pmr::vector<VertexType>::iterator getFilteredNeighborsIterator(
       const VertexType& vertexid, bool (*filter)(VertexType)) override;
 
   /**
    * @brief Возвращает список смежности.
-   * @return Константная ссылка на список смежности.
+   * @return Представление списка смежности без копирования (действует,
+   * пока граф не изменяется); преобразуется в std::unordered_map копией.
    */
-  const std::unordered_map<VertexType, std::vector<VertexType>>&
-  getAdjacencyList() ;
+  AdjacencyMapView<VertexType> getAdjacencyList() const;
 
   /**
    * @brief Проверяет наличие вершины в графе.
@@ -101,6 +128,26 @@ class AdjacencyListGraph : public Graph<VertexType, EdgeType> {
    */
   std::vector<VertexType> getAdjacencyVertices(
       const VertexType& vertex) override;
+
+  /**
+   * @brief Включает или выключает режим отсортированных списков соседей.
+   * @param sorted Новый режим; при включении все списки сортируются.
+   */
+  void setSortedNeighbors(bool sorted);
+
+  /**
+   * @brief Проверяет, поддерживаются ли списки соседей отсортированными.
+   * @return true, если включён режим отсортированных соседей.
+   */
+  bool hasSortedNeighbors() const;
+
+  /**
+   * @brief Возвращает список соседей вершины без копирования.
+   * @param vertex Вершина.
+   * @return Диапазон соседей (пустой, если вершины нет); действителен до
+   * следующего изменения графа.
+   */
+  NeighborRange<VertexType> getNeighbors(const VertexType& vertex) const;
 };
 
 }  // namespace graph
@@ -1,6 +1,8 @@
 #ifndef ADJACENCY_MATRIX_GRAPH_H
 #define ADJACENCY_MATRIX_GRAPH_H
 
+#include <cstdint>
+#include <memory_resource>
 #include <unordered_map>
 #include <vector>
 
@@ -16,10 +18,11 @@ namespace graph {
 template <typename VertexType = Vertex, typename EdgeType = Edge>
 class AdjacencyMatrixGraph : public Graph<VertexType, EdgeType> {
  private:
-  std::vector<std::vector<bool>> adjacencyMatrix;  ///< Матрица смежности.
-  std::unordered_map<VertexType, size_t>
+  std::pmr::vector<std::pmr::vector<uint64_t>>
+      adjacencyMatrix;  ///< Матрица смежности, строки упакованы в 64-битные слова.
+  std::pmr::unordered_map<VertexType, size_t>
       vertexToIndex;  ///< Соответствие ID вершины и индекса в матрице.
-  std::unordered_map<size_t, VertexType>
+  std::pmr::vector<VertexType>
       indexToVertex;  ///< Соответствие индекса в матрице и ID вершины.
 
   /**
@@ -29,12 +32,41 @@ class AdjacencyMatrixGraph : public Graph<VertexType, EdgeType> {
    */
   size_t getVertexIndex(const VertexType& id) const;
 
+  /**
+   * @brief Проверяет бит матрицы смежности.
+   * @param row Индекс строки.
+   * @param column Индекс столбца.
+   * @return true, если ребро row -> column присутствует.
+   */
+  bool testBit(size_t row, size_t column) const;
+
+  /**
+   * @brief Устанавливает или сбрасывает бит матрицы смежности.
+   * @param row Индекс строки.
+   * @param column Индекс столбца.
+   * @param value Новое значение бита.
+   */
+  void assignBit(size_t row, size_t column, bool value);
+
  public:
+  static constexpr size_t kWordBits = 64;  ///< Число бит в слове строки.
+
   /**
    * @brief Конструктор по умолчанию.
    */
   AdjacencyMatrixGraph() = default;
 
+  /**
+   * @brief Конструктор с источником памяти.
+   * @param resource Источник памяти для всех контейнеров графа; должен жить
+   * дольше графа.
+   */
+  explicit AdjacencyMatrixGraph(std::pmr::memory_resource* resource)
+      : Graph<VertexType, EdgeType>(resource),
+        adjacencyMatrix(resource),
+        vertexToIndex(resource),
+        indexToVertex(resource){};
+
   /**
    * @brief Добавляет вершину в граф.
    * @param id Вершина для добавления.
@@ -43,6 +75,11 @@ class AdjacencyMatrixGraph : public Graph<VertexType, EdgeType> {
 
   /**
    * @brief Удаляет вершину из графа.
+   *
+   * Строка и столбец последней вершины переносятся на место удаляемой, поэтому
+   * матрица остаётся плотной, а удаление занимает O(V). Индексы остальных
+   * вершин не меняются, кроме индекса последней.
+   *
    * @param id Вершина для удаления.
    */
   void removeVertex(const VertexType& id) override;
@@ -66,7 +103,7 @@ class AdjacencyMatrixGraph : public Graph<VertexType, EdgeType> {
    * @param vertexId Идентификатор вершины.
    * @return Итератор по соседям вершины.
    */
-  typename std::vector<VertexType>::iterator getNeighborsIterator(
+  typename std::pmr::vector<VertexType>::iterator getNeighborsIterator(
       const VertexType& vertexId) override;
 
   /**
@@ -75,7 +112,7 @@ class AdjacencyMatrixGraph : public Graph<VertexType, EdgeType> {
    * @param filter Функция-фильтр для соседей.
    * @return Итератор по соседям вершины, удовлетворяющим фильтру.
    */
-  typename std::vector<VertexType>::iterator getFilteredNeighborsIterator(
+  typename std::pmr::vector<VertexType>::iterator getFilteredNeighborsIterator(
       const VertexType& vertexId, bool (*filter)(VertexType)) override;
 
   /**
@@ -101,6 +138,27 @@ class AdjacencyMatrixGraph : public Graph<VertexType, EdgeType> {
    */
   std::vector<VertexType> getAdjacencyVertices(
       const VertexType& vertex) override;
+
+  /**
+   * @brief Возвращает число строк матрицы смежности.
+   * @return Количество вершин, хранящихся в матрице.
+   */
+  size_t getMatrixSize() const;
+
+  /**
+   * @brief Возвращает упакованную строку матрицы смежности.
+   * @param index Индекс вершины в матрице.
+   * @return Константная ссылка на слова строки; бит j слова j / 64
+   * соответствует ребру index -> j.
+   */
+  const std::pmr::vector<uint64_t>& getAdjacencyRow(size_t index) const;
+
+  /**
+   * @brief Возвращает вершину по индексу в матрице.
+   * @param index Индекс вершины в матрице.
+   * @return Вершина с данным индексом.
+   */
+  const VertexType& getVertexByIndex(size_t index) const;
 };
 
 }  // namespace graph
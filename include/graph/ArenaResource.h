@@ -0,0 +1,101 @@
+#ifndef ARENA_RESOURCE_H
+#define ARENA_RESOURCE_H
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace graph {
+
+/**
+ * @brief Арена с линейным (bump) выделением памяти для графов.
+ *
+ * Память берётся у вышестоящего источника блоками, размер которых растёт
+ * геометрически; выделение — сдвиг указателя внутри текущего блока. Отдельные
+ * освобождения ничего не делают: вся память возвращается разом через
+ * release() или деструктор. Подходит для графов, которые строятся целиком,
+ * обрабатываются и выбрасываются: граф и арена создаются вместе, а арена
+ * должна жить дольше всех графов, построенных на ней.
+ *
+ * Класс не потокобезопасен.
+ */
+class ArenaResource : public std::pmr::memory_resource {
+ public:
+  /**
+   * @brief Конструктор арены.
+   * @param initialBlockSize Размер первого блока в байтах.
+   * @param upstream Источник памяти для блоков.
+   */
+  explicit ArenaResource(
+      size_t initialBlockSize = 4096,
+      std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+
+  ArenaResource(const ArenaResource&) = delete;
+  ArenaResource& operator=(const ArenaResource&) = delete;
+
+  /**
+   * @brief Деструктор, освобождающий все блоки.
+   */
+  ~ArenaResource() override;
+
+  /**
+   * @brief Возвращает все блоки вышестоящему источнику.
+   *
+   * Все указатели, выданные ареной, становятся недействительными.
+   */
+  void release();
+
+  /**
+   * @brief Сбрасывает арену, оставляя наибольший блок для повторного
+   * использования.
+   *
+   * Все указатели, выданные ареной, становятся недействительными.
+   */
+  void reset();
+
+  /**
+   * @brief Возвращает число байт, выданных с момента последнего сброса.
+   */
+  size_t bytesAllocated() const;
+
+  /**
+   * @brief Возвращает число байт, полученных у вышестоящего источника.
+   */
+  size_t bytesReserved() const;
+
+  /**
+   * @brief Возвращает вышестоящий источник памяти.
+   */
+  std::pmr::memory_resource* getUpstream() const;
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override;
+
+ private:
+  /**
+   * @brief Заголовок блока, размещается в начале самого блока.
+   */
+  struct Block {
+    Block* next;  ///< Предыдущий выделенный блок.
+    size_t size;  ///< Размер блока вместе с заголовком.
+  };
+
+  /**
+   * @brief Выделяет новый блок, вмещающий запрос заданного размера.
+   */
+  void allocateBlock(size_t bytes, size_t alignment);
+
+  std::pmr::memory_resource* upstream;  ///< Источник памяти для блоков.
+  Block* blocks = nullptr;              ///< Список блоков, текущий — первый.
+  char* cursor = nullptr;               ///< Начало свободной части блока.
+  char* limit = nullptr;                ///< Конец текущего блока.
+  size_t nextBlockSize;                 ///< Размер следующего блока.
+  size_t allocated = 0;                 ///< Выдано байт с последнего сброса.
+  size_t reserved = 0;                  ///< Получено байт у источника.
+};
+
+}  // namespace graph
+
+#endif  // ARENA_RESOURCE_H
@@ -18,6 +18,14 @@ class DirectedGraph : public Graph<VertexType, EdgeType> {
    */
   DirectedGraph() = default;
 
+  /**
+   * @brief Конструктор с источником памяти.
+   * @param resource Источник памяти для всех контейнеров графа; должен жить
+   * дольше графа.
+   */
+  explicit DirectedGraph(std::pmr::memory_resource* resource)
+      : Graph<VertexType, EdgeType>(resource){};
+
   /**
    * @brief Добавляет ориентированное ребро в граф.
    * @param source Исходная вершина ребра.
@@ -46,7 +54,7 @@ class DirectedGraph : public Graph<VertexType, EdgeType> {
    * @param vertexId Идентификатор вершины.
    * @return Итератор по соседям вершины.
    */
-  typename std::vector<VertexType>::iterator getNeighborsIterator(
+  typename std::pmr::vector<VertexType>::iterator getNeighborsIterator(
       const VertexType& vertexId) override;
 
   /**
@@ -55,7 +63,7 @@ class DirectedGraph : public Graph<VertexType, EdgeType> {
    * @param filter Функция-фильтр для соседей.
    * @return Итератор по соседям вершины, удовлетворяющим фильтру.
    */
-  typename std::vector<VertexType>::iterator getFilteredNeighborsIterator(
+  typename std::pmr::vector<VertexType>::iterator getFilteredNeighborsIterator(
       const VertexType& vertexId, bool (*filter)(VertexType)) override;
 
   /**
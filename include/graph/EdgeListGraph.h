@@ -1,6 +1,7 @@
 #ifndef EDGE_LIST_GRAPH_H
 #define EDGE_LIST_GRAPH_H
 
+#include <memory_resource>
 #include <unordered_set>
 #include <vector>
 
@@ -16,7 +17,7 @@ namespace graph {
 template <typename VertexType = Vertex, typename EdgeType = Edge>
 class EdgeListGraph : public Graph<VertexType, EdgeType> {
  private:
-  std::unordered_set<VertexType>
+  std::pmr::unordered_set<VertexType>
       verticesSet;  ///< Множество вершин для быстрой проверки их наличия.
 
  public:
@@ -25,6 +26,14 @@ class EdgeListGraph : public Graph<VertexType, EdgeType> {
    */
   EdgeListGraph() = default;
 
+  /**
+   * @brief Конструктор с источником памяти.
+   * @param resource Источник памяти для всех контейнеров графа; должен жить
+   * дольше графа.
+   */
+  explicit EdgeListGraph(std::pmr::memory_resource* resource)
+      : Graph<VertexType, EdgeType>(resource), verticesSet(resource){};
+
   /**
    * @brief Добавляет вершину в граф.
    * @param id Вершина для добавления.
@@ -56,7 +65,7 @@ class EdgeListGraph : public Graph<VertexType, EdgeType> {
    * @param vertexId Идентификатор вершины.
    * @return Итератор по соседям вершины.
    */
-  typename std::vector<VertexType>::iterator getNeighborsIterator(
+  typename std::pmr::vector<VertexType>::iterator getNeighborsIterator(
       const VertexType& vertexId) override;
 
   /**
@@ -65,7 +74,7 @@ class EdgeListGraph : public Graph<VertexType, EdgeType> {
    * @param filter Функция-фильтр для соседей.
    * @return Итератор по соседям вершины, удовлетворяющим фильтру.
    */
-  typename std::vector<VertexType>::iterator getFilteredNeighborsIterator(
+  typename std::pmr::vector<VertexType>::iterator getFilteredNeighborsIterator(
       const VertexType& VertexId, bool (*filter)(VertexType)) override;
 
   /**
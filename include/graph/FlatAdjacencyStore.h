@@ -0,0 +1,475 @@
+#ifndef FLAT_ADJACENCY_STORE_H
+#define FLAT_ADJACENCY_STORE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory_resource>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace graph {
+
+/**
+ * @brief Непрерывный диапазон соседей вершины (представление без владения).
+ * @tparam VertexType Тип вершины.
+ */
+template <typename VertexType>
+class NeighborRange {
+ public:
+  /**
+   * @brief Конструктор диапазона.
+   * @param first Указатель на первого соседа.
+   * @param count Число соседей.
+   */
+  NeighborRange(const VertexType* first, size_t count)
+      : first(first), count(count){};
+
+  const VertexType* begin() const { return first; }
+  const VertexType* end() const { return first + count; }
+  const VertexType* data() const { return first; }
+  size_t size() const { return count; }
+  bool empty() const { return count == 0; }
+  const VertexType& operator[](size_t i) const { return first[i]; }
+  const VertexType& front() const { return first[0]; }
+  const VertexType& back() const { return first[count - 1]; }
+
+ private:
+  const VertexType* first;  ///< Первый сосед.
+  size_t count;             ///< Число соседей.
+};
+
+/**
+ * @brief Плоское хранилище списков смежности.
+ *
+ * Вершины лежат в хэш-таблице с открытой адресацией и линейным пробированием,
+ * каждая ячейка которой хранит смещение, размер и ёмкость своего списка
+ * соседей. Все списки соседей размещены в одном общем массиве (slab): при
+ * переполнении список переезжает в конец массива с удвоенной ёмкостью, а
+ * освободившиеся участки собираются уплотнением, когда их становится больше
+ * половины массива. Отдельных выделений памяти на вершину нет.
+ *
+ * @tparam VertexType Тип вершины (должна быть определена std::hash).
+ */
+template <typename VertexType>
+class FlatAdjacencyStore {
+ public:
+  static constexpr size_t npos = static_cast<size_t>(-1);  ///< Нет ячейки.
+
+  /**
+   * @brief Конструктор по умолчанию.
+   */
+  FlatAdjacencyStore() = default;
+
+  /**
+   * @brief Конструктор с источником памяти для таблицы и общего массива.
+   * @param resource Источник памяти.
+   */
+  explicit FlatAdjacencyStore(std::pmr::memory_resource* resource)
+      : slots(resource), slab(resource){};
+
+  /**
+   * @brief Ищет ячейку вершины.
+   * @param vertex Вершина.
+   * @return Индекс ячейки или npos, если вершины нет.
+   */
+  size_t find(const VertexType& vertex) const {
+    if (slots.empty()) return npos;
+    for (size_t i = bucket(vertex);; i = (i + 1) & mask()) {
+      const Slot& slot = slots[i];
+      if (slot.state == kEmpty) return npos;
+      if (slot.state == kOccupied && slot.vertex == vertex) return i;
+    }
+  }
+
+  /**
+   * @brief Добавляет вершину с пустым списком соседей.
+   * @param vertex Вершина.
+   * @return Индекс ячейки вершины (существующей или новой).
+   */
+  size_t insert(const VertexType& vertex) {
+    size_t existing = find(vertex);
+    if (existing != npos) return existing;
+    if ((occupied + tombstones + 1) * 8 > slots.size() * 7) {
+      rehash(occupied + 1);
+    }
+    size_t i = bucket(vertex);
+    while (slots[i].state == kOccupied) {
+      i = (i + 1) & mask();
+    }
+    if (slots[i].state == kDeleted) --tombstones;
+    slots[i] = Slot{vertex, kOccupied, 0, 0, 0};
+    ++occupied;
+    return i;
+  }
+
+  /**
+   * @brief Удаляет вершину и освобождает её список соседей.
+   * @param vertex Вершина.
+   * @return true, если вершина была в хранилище.
+   */
+  bool erase(const VertexType& vertex) {
+    size_t i = find(vertex);
+    if (i == npos) return false;
+    garbage += slots[i].capacity;
+    slots[i].state = kDeleted;
+    slots[i].size = slots[i].capacity = 0;
+    --occupied;
+    ++tombstones;
+    return true;
+  }
+
+  /**
+   * @brief Возвращает соседей вершины из ячейки.
+   * @param slot Индекс ячейки.
+   * @return Диапазон соседей.
+   */
+  NeighborRange<VertexType> neighbors(size_t slot) const {
+    return NeighborRange<VertexType>(slab.data() + slots[slot].offset,
+                                     slots[slot].size);
+  }
+
+  /**
+   * @brief Возвращает изменяемый итератор на начало списка соседей.
+   * @param slot Индекс ячейки.
+   * @return Итератор в общий массив соседей.
+   */
+  typename std::pmr::vector<VertexType>::iterator neighborsBegin(size_t slot) {
+    return slab.begin() + slots[slot].offset;
+  }
+
+  /**
+   * @brief Итератор за концом общего массива (для отсутствующих вершин).
+   */
+  typename std::pmr::vector<VertexType>::iterator slabEnd() {
+    return slab.end();
+  }
+
+  /**
+   * @brief Вставляет соседа в заданную позицию списка.
+   * @param slot Индекс ячейки.
+   * @param position Позиция в списке (0..size).
+   * @param neighbor Сосед.
+   */
+  void insertNeighbor(size_t slot, size_t position,
+                      const VertexType& neighbor) {
+    reserveNeighbor(slot);
+    Slot& s = slots[slot];
+    VertexType* list = slab.data() + s.offset;
+    std::move_backward(list + position, list + s.size, list + s.size + 1);
+    list[position] = neighbor;
+    ++s.size;
+  }
+
+  /**
+   * @brief Добавляет соседа в конец списка.
+   * @param slot Индекс ячейки.
+   * @param neighbor Сосед.
+   */
+  void pushNeighbor(size_t slot, const VertexType& neighbor) {
+    insertNeighbor(slot, slots[slot].size, neighbor);
+  }
+
+  /**
+   * @brief Удаляет все вхождения соседа, сохраняя порядок остальных.
+   * @param slot Индекс ячейки.
+   * @param neighbor Сосед.
+   */
+  void removeNeighbor(size_t slot, const VertexType& neighbor) {
+    Slot& s = slots[slot];
+    VertexType* list = slab.data() + s.offset;
+    VertexType* last = std::remove(list, list + s.size, neighbor);
+    s.size = static_cast<uint32_t>(last - list);
+  }
+
+  /**
+   * @brief Удаляет соседа из списков всех вершин.
+   * @param neighbor Сосед.
+   */
+  void removeNeighborEverywhere(const VertexType& neighbor) {
+    for (size_t i = 0; i < slots.size(); ++i) {
+      if (slots[i].state == kOccupied) removeNeighbor(i, neighbor);
+    }
+  }
+
+  /**
+   * @brief Сортирует списки соседей всех вершин.
+   * @tparam Compare Тип компаратора.
+   * @param compare Компаратор.
+   */
+  template <typename Compare>
+  void sortAllNeighbors(Compare compare) {
+    for (const Slot& s : slots) {
+      if (s.state != kOccupied) continue;
+      std::sort(slab.data() + s.offset, slab.data() + s.offset + s.size,
+                compare);
+    }
+  }
+
+  /**
+   * @brief Вызывает f(vertex, slot) для каждой занятой ячейки.
+   * @tparam Function Тип обработчика.
+   * @param f Обработчик.
+   */
+  template <typename Function>
+  void forEachSlot(Function&& f) const {
+    for (size_t i = 0; i < slots.size(); ++i) {
+      if (slots[i].state == kOccupied) f(slots[i].vertex, i);
+    }
+  }
+
+  /**
+   * @brief Возвращает число вершин в хранилище.
+   */
+  size_t size() const { return occupied; }
+
+  /**
+   * @brief Возвращает число ячеек хэш-таблицы (занятых и свободных).
+   */
+  size_t slotCount() const { return slots.size(); }
+
+  /**
+   * @brief Проверяет, занята ли ячейка вершиной.
+   * @param slot Индекс ячейки.
+   */
+  bool isOccupied(size_t slot) const {
+    return slots[slot].state == kOccupied;
+  }
+
+  /**
+   * @brief Возвращает вершину занятой ячейки.
+   * @param slot Индекс ячейки.
+   */
+  const VertexType& vertexAt(size_t slot) const { return slots[slot].vertex; }
+
+ private:
+  static constexpr uint32_t kEmpty = 0;     ///< Ячейка не использовалась.
+  static constexpr uint32_t kOccupied = 1;  ///< Ячейка занята вершиной.
+  static constexpr uint32_t kDeleted = 2;   ///< Ячейка освобождена.
+
+  /**
+   * @brief Ячейка хэш-таблицы вершин.
+   */
+  struct Slot {
+    VertexType vertex;  ///< Вершина.
+    uint32_t state;     ///< Состояние ячейки.
+    size_t offset;      ///< Начало списка соседей в общем массиве.
+    uint32_t size;      ///< Число соседей.
+    uint32_t capacity;  ///< Зарезервированное место под соседей.
+  };
+
+  std::pmr::vector<Slot> slots;  ///< Хэш-таблица, размер — степень двойки.
+  std::pmr::vector<VertexType> slab;  ///< Общий массив списков соседей.
+  size_t occupied = 0;           ///< Число занятых ячеек.
+  size_t tombstones = 0;         ///< Число освобождённых ячеек.
+  size_t garbage = 0;  ///< Число неиспользуемых элементов в slab.
+
+  size_t mask() const { return slots.size() - 1; }
+
+  /**
+   * @brief Начальная ячейка пробирования (фибоначчиево хэширование).
+   */
+  size_t bucket(const VertexType& vertex) const {
+    uint64_t h = static_cast<uint64_t>(std::hash<VertexType>{}(vertex));
+    return static_cast<size_t>((h * 0x9E3779B97F4A7C15ull) >> 32) & mask();
+  }
+
+  /**
+   * @brief Перестраивает таблицу под заданное число вершин, удаляя
+   * освобождённые ячейки.
+   */
+  void rehash(size_t required) {
+    size_t capacity = 16;
+    while (capacity * 7 < required * 8 * 2) {
+      capacity *= 2;
+    }
+    std::pmr::vector<Slot> old(slots.get_allocator());
+    old.swap(slots);
+    slots.assign(capacity, Slot{VertexType(), kEmpty, 0, 0, 0});
+    tombstones = 0;
+    for (const Slot& slot : old) {
+      if (slot.state != kOccupied) continue;
+      size_t i = bucket(slot.vertex);
+      while (slots[i].state == kOccupied) {
+        i = (i + 1) & mask();
+      }
+      slots[i] = slot;
+    }
+  }
+
+  /**
+   * @brief Гарантирует место под ещё одного соседа в списке ячейки.
+   */
+  void reserveNeighbor(size_t slot) {
+    Slot& s = slots[slot];
+    if (s.size < s.capacity) return;
+    uint32_t capacity = std::max<uint32_t>(4, s.capacity * 2);
+
+    // Список в конце массива растёт на месте
+    if (s.offset + s.capacity == slab.size() && s.capacity != 0) {
+      slab.resize(s.offset + capacity);
+      s.capacity = capacity;
+      return;
+    }
+
+    if (garbage > slab.size() / 2 && garbage > 1024) {
+      compact();
+    }
+    size_t offset = slab.size();
+    slab.resize(offset + capacity);
+    std::copy(slab.begin() + s.offset, slab.begin() + s.offset + s.size,
+              slab.begin() + offset);
+    garbage += s.capacity;
+    s.offset = offset;
+    s.capacity = capacity;
+  }
+
+  /**
+   * @brief Переупаковывает общий массив, убирая освобождённые участки.
+   */
+  void compact() {
+    std::pmr::vector<VertexType> packed(slab.get_allocator());
+    packed.reserve(slab.size() - garbage);
+    for (Slot& s : slots) {
+      if (s.state != kOccupied) continue;
+      size_t offset = packed.size();
+      packed.insert(packed.end(), slab.begin() + s.offset,
+                    slab.begin() + s.offset + s.capacity);
+      s.offset = offset;
+    }
+    slab.swap(packed);
+    garbage = 0;
+  }
+};
+
+/**
+ * @brief Представление хранилища смежности в виде хэш-таблицы «вершина ->
+ * соседи» (без владения и копирования).
+ *
+ * Повторяет интерфейс чтения std::unordered_map: size, count, at, обход
+ * пар (вершина, соседи). Остаётся действительным, пока хранилище не
+ * изменяется.
+ *
+ * @tparam VertexType Тип вершины.
+ */
+template <typename VertexType>
+class AdjacencyMapView {
+ public:
+  using key_type = VertexType;
+  using mapped_type = NeighborRange<VertexType>;
+  using value_type = std::pair<const VertexType&, NeighborRange<VertexType>>;
+
+  /**
+   * @brief Итератор по занятым ячейкам хранилища.
+   */
+  class const_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = AdjacencyMapView::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = value_type;
+
+    const_iterator(const FlatAdjacencyStore<VertexType>* store, size_t slot)
+        : store(store), slot(slot) {
+      skipFree();
+    }
+
+    value_type operator*() const {
+      return {store->vertexAt(slot), store->neighbors(slot)};
+    }
+
+    const_iterator& operator++() {
+      ++slot;
+      skipFree();
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator old = *this;
+      ++*this;
+      return old;
+    }
+
+    bool operator==(const const_iterator& other) const {
+      return slot == other.slot;
+    }
+    bool operator!=(const const_iterator& other) const {
+      return slot != other.slot;
+    }
+
+   private:
+    const FlatAdjacencyStore<VertexType>* store;  ///< Хранилище.
+    size_t slot;                                  ///< Текущая ячейка.
+
+    void skipFree() {
+      while (slot < store->slotCount() && !store->isOccupied(slot)) {
+        ++slot;
+      }
+    }
+  };
+  using iterator = const_iterator;
+
+  /**
+   * @brief Конструктор представления.
+   * @param store Хранилище; должно жить дольше представления.
+   */
+  explicit AdjacencyMapView(const FlatAdjacencyStore<VertexType>& store)
+      : store(&store){};
+
+  const_iterator begin() const { return const_iterator(store, 0); }
+  const_iterator end() const {
+    return const_iterator(store, store->slotCount());
+  }
+  size_t size() const { return store->size(); }
+  bool empty() const { return store->size() == 0; }
+
+  /**
+   * @brief Возвращает 1, если вершина есть в хранилище, иначе 0.
+   */
+  size_t count(const VertexType& vertex) const {
+    return store->find(vertex) != store->npos ? 1 : 0;
+  }
+
+  /**
+   * @brief Проверяет наличие вершины.
+   */
+  bool contains(const VertexType& vertex) const { return count(vertex) != 0; }
+
+  /**
+   * @brief Возвращает соседей вершины.
+   * @param vertex Вершина.
+   * @throws std::out_of_range Если вершины нет.
+   */
+  NeighborRange<VertexType> at(const VertexType& vertex) const {
+    size_t slot = store->find(vertex);
+    if (slot == store->npos) {
+      throw std::out_of_range("Vertex not found");
+    }
+    return store->neighbors(slot);
+  }
+
+  /**
+   * @brief Копирует представление в std::unordered_map.
+   */
+  operator std::unordered_map<VertexType, std::vector<VertexType>>() const {
+    std::unordered_map<VertexType, std::vector<VertexType>> result;
+    result.reserve(size());
+    for (const auto& [vertex, neighbors] : *this) {
+      result.emplace(vertex, std::vector<VertexType>(neighbors.begin(),
+                                                     neighbors.end()));
+    }
+    return result;
+  }
+
+ private:
+  const FlatAdjacencyStore<VertexType>* store;  ///< Хранилище.
+};
+
+}  // namespace graph
+
+#endif  // FLAT_ADJACENCY_STORE_H
@@ -5,6 +5,7 @@
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <memory_resource>
 #include <vector>
 
 namespace graph {
@@ -127,6 +128,68 @@ class WeightedEdge : public Edge {
       : Edge(source, target, 0), weight(0){};
 };
 
+/**
+ * @brief Представление только для чтения над std::pmr::vector.
+ *
+ * Возвращается из getVertices() и getEdges(): не копирует элементы, ведёт
+ * себя как константный вектор и неявно приводится как к
+ * const std::pmr::vector<T>&, так и к std::vector<T> (копированием), так что
+ * код вида std::vector<Vertex> v = graph.getVertices(); продолжает
+ * компилироваться после перехода контейнеров графа на std::pmr.
+ *
+ * @tparam T Тип элемента.
+ */
+template <typename T>
+class VectorView {
+ public:
+  using value_type = T;  ///< Тип элемента.
+  using size_type = typename std::pmr::vector<T>::size_type;  ///< Размер.
+  using const_reference = const T&;                           ///< Ссылка.
+  using const_iterator =
+      typename std::pmr::vector<T>::const_iterator;  ///< Итератор.
+  using iterator = const_iterator;                   ///< Итератор.
+
+  /**
+   * @brief Конструктор.
+   * @param items Вектор; должен жить дольше представления.
+   */
+  explicit VectorView(const std::pmr::vector<T>& items) : items(&items) {}
+
+  const_iterator begin() const { return items->begin(); }  ///< Начало.
+  const_iterator end() const { return items->end(); }      ///< Конец.
+  const_iterator cbegin() const { return items->cbegin(); }  ///< Начало.
+  const_iterator cend() const { return items->cend(); }      ///< Конец.
+  size_type size() const { return items->size(); }  ///< Число элементов.
+  bool empty() const { return items->empty(); }     ///< Пусто ли.
+  const T* data() const { return items->data(); }   ///< Данные.
+  const T& front() const { return items->front(); }  ///< Первый элемент.
+  const T& back() const { return items->back(); }    ///< Последний элемент.
+
+  /**
+   * @brief Доступ к элементу по индексу.
+   */
+  const T& operator[](size_type i) const { return (*items)[i]; }
+
+  /**
+   * @brief Доступ к элементу с проверкой индекса.
+   * @throws std::out_of_range Если индекс вне вектора.
+   */
+  const T& at(size_type i) const { return items->at(i); }
+
+  /**
+   * @brief Приведение к исходному вектору без копирования.
+   */
+  operator const std::pmr::vector<T>&() const { return *items; }
+
+  /**
+   * @brief Копирование в std::vector.
+   */
+  operator std::vector<T>() const { return {items->begin(), items->end()}; }
+
+ private:
+  const std::pmr::vector<T>* items;  ///< Исходный вектор.
+};
+
 /**
  * @brief Базовый класс графа.
  * @tparam VertexType Тип вершины (по умолчанию Vertex).
@@ -135,8 +198,8 @@ class WeightedEdge : public Edge {
 template <typename VertexType = Vertex, typename EdgeType = Edge>
 class Graph {
  protected:
-  std::vector<VertexType> vertices;  ///< Список вершин.
-  std::vector<EdgeType> edges;       ///< Список рёбер.
+  std::pmr::vector<VertexType> vertices;  ///< Список вершин.
+  std::pmr::vector<EdgeType> edges;       ///< Список рёбер.
 
  public:
   /**
@@ -144,6 +207,14 @@ class Graph {
    */
   Graph() = default;
 
+  /**
+   * @brief Конструктор с источником памяти.
+   * @param resource Источник памяти для всех контейнеров графа (например,
+   * ArenaResource); должен жить дольше графа.
+   */
+  explicit Graph(std::pmr::memory_resource* resource)
+      : vertices(resource), edges(resource){};
+
   /**
    * @brief Виртуальный деструктор.
    */
@@ -179,22 +250,29 @@ class Graph {
 
   /**
    * @brief Возвращает список вершин.
-   * @return Константная ссылка на список вершин.
+   * @return Представление списка вершин без копирования.
    */
-  const std::vector<VertexType>& getVertices() const;
+  VectorView<VertexType> getVertices() const;
 
   /**
    * @brief Возвращает список рёбер.
-   * @return Константная ссылка на список рёбер.
+   * @return Представление списка рёбер без копирования.
+   */
+  VectorView<EdgeType> getEdges() const;
+
+  /**
+   * @brief Возвращает источник памяти графа.
+   * @return Указатель на источник памяти, переданный в конструктор (или
+   * источник по умолчанию).
    */
-  const std::vector<EdgeType>& getEdges() const;
+  std::pmr::memory_resource* getMemoryResource() const;
 
   /**
    * @brief Возвращает итератор по соседям вершины.
    * @param vertexId Идентификатор вершины.
    * @return Итератор по соседям вершины.
    */
-  virtual typename std::vector<VertexType>::iterator getNeighborsIterator(
+  virtual typename std::pmr::vector<VertexType>::iterator getNeighborsIterator(
       const VertexType& vertexId);
 
   /**
@@ -203,7 +281,7 @@ class Graph {
    * @param filter Функция-фильтр.
    * @return Итератор по соседям вершины, удовлетворяющим фильтру.
    */
-  virtual typename std::vector<VertexType>::iterator
+  virtual typename std::pmr::vector<VertexType>::iterator
   getFilteredNeighborsIterator(const VertexType& vertexId,
                                bool (*filter)(VertexType));
 
@@ -1,12 +1,24 @@
 #ifndef UNDIRECTED_GRAPH_H
 #define UNDIRECTED_GRAPH_H
 
+#include <cstdint>
+#include <unordered_map>
+
 #include "Graph.h"
 
 namespace graph {
 
 /**
  * @brief Класс, реализующий неориентированный граф.
+ *
+ * По желанию граф поддерживает систему непересекающихся множеств вершин
+ * (сжатие путей, объединение по рангу), которая обновляется в addEdge и
+ * отвечает на connected() за O(log V) и на componentCount() за O(1).
+ * Удаление ребра или вершины перестраивает её по всем рёбрам — за то же
+ * время O(V + E), что и само удаление. Все изменения делают только
+ * неконстантные методы, поэтому connected() и componentCount() можно
+ * вызывать из нескольких потоков одновременно, пока граф не меняется.
+ *
  * @tparam VertexType Тип вершины (по умолчанию Vertex).
  * @tparam EdgeType Тип ребра (по умолчанию Edge).
  */
@@ -18,6 +30,47 @@ class UndirectedGraph : public Graph<VertexType, EdgeType> {
    */
   UndirectedGraph() = default;
 
+  /**
+   * @brief Конструктор с источником памяти.
+   * @param resource Источник памяти для всех контейнеров графа; должен жить
+   * дольше графа.
+   */
+  explicit UndirectedGraph(std::pmr::memory_resource* resource)
+      : Graph<VertexType, EdgeType>(resource), connectivity(resource){};
+
+  /**
+   * @brief Конструктор с выбором отслеживания связности.
+   * @param trackConnectivity Если true, граф поддерживает компоненты
+   * связности для connected() и componentCount().
+   */
+  explicit UndirectedGraph(bool trackConnectivity)
+      : Graph<VertexType, EdgeType>() {
+    connectivity.enabled = trackConnectivity;
+  }
+
+  /**
+   * @brief Конструктор с источником памяти и выбором отслеживания связности.
+   * @param resource Источник памяти для всех контейнеров графа; должен жить
+   * дольше графа.
+   * @param trackConnectivity Отслеживать ли компоненты связности.
+   */
+  UndirectedGraph(std::pmr::memory_resource* resource, bool trackConnectivity)
+      : Graph<VertexType, EdgeType>(resource), connectivity(resource) {
+    connectivity.enabled = trackConnectivity;
+  }
+
+  /**
+   * @brief Добавляет вершину в граф.
+   * @param vertex Вершина для добавления.
+   */
+  void addVertex(const VertexType& vertex) override;
+
+  /**
+   * @brief Удаляет вершину и её рёбра из графа.
+   * @param vertex Вершина для удаления.
+   */
+  void removeVertex(const VertexType& vertex) override;
+
   /**
    * @brief Добавляет неориентированное ребро в граф.
    * @param source Исходная вершина ребра.
@@ -46,7 +99,7 @@ class UndirectedGraph : public Graph<VertexType, EdgeType> {
    * @param vertexId Идентификатор вершины.
    * @return Итератор по соседям вершины.
    */
-  typename std::vector<VertexType>::iterator getNeighborsIterator(
+  typename std::pmr::vector<VertexType>::iterator getNeighborsIterator(
       const VertexType& vertexId) override;
 
   /**
@@ -55,7 +108,7 @@ class UndirectedGraph : public Graph<VertexType, EdgeType> {
    * @param filter Функция-фильтр для соседей.
    * @return Итератор по соседям вершины, удовлетворяющим фильтру.
    */
-  typename std::vector<VertexType>::iterator getFilteredNeighborsIterator(
+  typename std::pmr::vector<VertexType>::iterator getFilteredNeighborsIterator(
       const VertexType& vertexId, bool (*filter)(VertexType)) override;
 
   /**
@@ -65,6 +118,91 @@ class UndirectedGraph : public Graph<VertexType, EdgeType> {
    */
   std::vector<VertexType> getAdjacencyVertices(
       const VertexType& vertex) override;
+
+  /**
+   * @brief Включает или выключает отслеживание связности.
+   *
+   * При включении компоненты сразу строятся по текущим рёбрам; при
+   * выключении память под них освобождается.
+   *
+   * @param track Отслеживать ли компоненты связности.
+   */
+  void setConnectivityTracking(bool track);
+
+  /**
+   * @brief Проверяет, отслеживается ли связность.
+   * @return true, если отслеживание включено.
+   */
+  bool tracksConnectivity() const;
+
+  /**
+   * @brief Проверяет, лежат ли две вершины в одной компоненте связности.
+   * @param a Первая вершина.
+   * @param b Вторая вершина.
+   * @return true, если вершины связаны путём.
+   * @throws std::logic_error Если отслеживание связности выключено.
+   * @throws std::out_of_range Если вершины нет в графе.
+   */
+  bool connected(const VertexType& a, const VertexType& b) const;
+
+  /**
+   * @brief Возвращает число компонент связности.
+   * @throws std::logic_error Если отслеживание связности выключено.
+   */
+  size_t componentCount() const;
+
+ private:
+  /**
+   * @brief Система непересекающихся множеств по индексам вершин.
+   */
+  struct Connectivity {
+    bool enabled = false;  ///< Отслеживание включено.
+    std::pmr::unordered_map<VertexType, uint32_t> index;  ///< Индексы вершин.
+    std::pmr::vector<uint32_t> parent;  ///< Родители в лесу множеств.
+    std::pmr::vector<uint8_t> rank;     ///< Ранги корней.
+    size_t components = 0;              ///< Число множеств.
+
+    /// Контейнеры на источнике памяти по умолчанию.
+    Connectivity() = default;
+
+    /// Контейнеры на источнике памяти графа.
+    explicit Connectivity(std::pmr::memory_resource* resource)
+        : index(resource), parent(resource), rank(resource) {}
+  };
+
+  Connectivity connectivity;  ///< Компоненты связности.
+
+  /**
+   * @brief Перестраивает множества по всем рёбрам, если связность
+   * отслеживается.
+   */
+  void rebuildConnectivity();
+
+  /**
+   * @brief Проверяет, что связность отслеживается.
+   * @throws std::logic_error Если отслеживание связности выключено.
+   */
+  void requireConnectivity() const;
+
+  /**
+   * @brief Добавляет вершину отдельным множеством.
+   */
+  void addConnectivityVertex(const VertexType& vertex);
+
+  /**
+   * @brief Находит корень множества со сжатием пути.
+   */
+  uint32_t findRoot(uint32_t v);
+
+  /**
+   * @brief Находит корень множества без изменения леса.
+   */
+  uint32_t findRootReadOnly(uint32_t v) const;
+
+  /**
+   * @brief Объединяет множества двух вершин по рангу.
+   */
+  void unite(const VertexType& a, const VertexType& b);
 };
 
 }  // namespace graph
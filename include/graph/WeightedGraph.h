@@ -18,6 +18,14 @@ class WeightedGraph : public Graph<VertexType, WeightedEdge<WeightType>> {
    */
   WeightedGraph() = default;
 
+  /**
+   * @brief Конструктор с источником памяти.
+   * @param resource Источник памяти для всех контейнеров графа; должен жить
+   * дольше графа.
+   */
+  explicit WeightedGraph(std::pmr::memory_resource* resource)
+      : Graph<VertexType, WeightedEdge<WeightType>>(resource){};
+
   /**
    * @brief Добавляет взвешенное ребро в граф.
    * @param source Исходная вершина ребра.
@@ -57,7 +65,7 @@ class WeightedGraph : public Graph<VertexType, WeightedEdge<WeightType>> {
    * @param vertexId Идентификатор вершины.
    * @return Итератор по соседям вершины.
    */
-  typename std::vector<VertexType>::iterator getNeighborsIterator(
+  typename std::pmr::vector<VertexType>::iterator getNeighborsIterator(
       const VertexType& vertexId) override;
 
   /**
@@ -66,7 +74,7 @@ class WeightedGraph : public Graph<VertexType, WeightedEdge<WeightType>> {
    * @param filter Функция-фильтр для соседей.
    * @return Итератор по соседям вершины, удовлетворяющим фильтру.
    */
-  typename std::vector<VertexType>::iterator getFilteredNeighborsIterator(
+  typename std::pmr::vector<VertexType>::iterator getFilteredNeighborsIterator(
       const VertexType& vertexId, bool (*filter)(VertexType)) override;
 
   /**
@@ -2,11 +2,44 @@
 #define BFS_VISITOR_H
 
 #include <iostream>
+#include <type_traits>
 
 namespace graph {
 
 /**
- * @brief Базовый класс для посетителя (Visitor) в алгоритме BFS.
+ * @brief Решение посетителя о дальнейшем ходе обхода.
+ *
+ * Методы статического посетителя могут возвращать его вместо void.
+ */
+enum class VisitorAction {
+  Continue,      ///< Продолжить обход.
+  SkipChildren,  ///< Не раскрывать вершину или не проходить по ребру.
+  Stop           ///< Немедленно завершить обход.
+};
+
+/**
+ * @brief Вызывает метод посетителя и возвращает его решение.
+ *
+ * Метод, возвращающий void, всегда означает VisitorAction::Continue.
+ *
+ * @param callback Вызов метода посетителя.
+ * @return Решение посетителя.
+ */
+template <typename Callback>
+VisitorAction visitorAction(Callback&& callback) {
+  if constexpr (std::is_void_v<decltype(callback())>) {
+    callback();
+    return VisitorAction::Continue;
+  } else {
+    return callback();
+  }
+}
+
+/**
+ * @brief Базовый класс для посетителя (Visitor) с виртуальными методами.
+ *
+ * Обходы принимают его через VisitorAdapter; новым посетителям выгоднее
+ * наследовать NullVisitor.
  * @tparam VertexType Тип вершины.
  * @tparam EdgeType Тип ребра.
  */
@@ -42,6 +75,24 @@ class Visitor {
    */
   virtual void treeEdge(const EdgeType& edge) {}
 
+  /**
+   * @brief Метод, вызываемый для обратного ребра поиска в глубину.
+   * @param edge Ребро к предку в дереве поиска.
+   */
+  virtual void backEdge(const EdgeType& edge) {}
+
+  /**
+   * @brief Метод, вызываемый для прямого ребра поиска в глубину.
+   * @param edge Ребро к уже завершённому потомку.
+   */
+  virtual void forwardEdge(const EdgeType& edge) {}
+
+  /**
+   * @brief Метод, вызываемый для перекрёстного ребра поиска в глубину.
+   * @param edge Ребро к завершённой вершине другого поддерева.
+   */
+  virtual void crossEdge(const EdgeType& edge) {}
+
   /**
    * @brief Метод, вызываемый при завершении обработки вершины.
    * @param vertex Вершина, обработка которой завершена.
@@ -49,6 +100,153 @@ class Visitor {
   virtual void finishVertex(const VertexType& vertex) {}
 };
 
+/**
+ * @brief Посетитель с пустыми невиртуальными методами.
+ *
+ * Базовый класс для посетителей со статической диспетчеризацией: BFS и DFS
+ * шаблонны по типу посетителя и вызывают методы напрямую, поэтому пустые
+ * методы исчезают при компиляции. Наследник переопределяет (скрывает) только
+ * нужные методы. Рёбра передаются парой концов, без создания объекта ребра.
+ * С VertexType = size_t тот же класс служит базой для посетителей, которые
+ * получают индексы вершин (см. DepthFirstSearch).
+ * Скрывающий метод может вернуть VisitorAction, чтобы отсечь поддерево или
+ * остановить обход.
+ *
+ * @tparam VertexType Тип вершины.
+ */
+template <typename VertexType>
+class NullVisitor {
+ public:
+  /**
+   * @brief Метод, вызываемый при обнаружении вершины.
+   * @param vertex Вершина, которая была обнаружена.
+   */
+  void discoverVertex(const VertexType& vertex) {}
+
+  /**
+   * @brief Метод, вызываемый при посещении вершины.
+   * @param vertex Вершина, которая была посещена.
+   */
+  void visitVertex(const VertexType& vertex) {}
+
+  /**
+   * @brief Метод, вызываемый при исследовании ребра.
+   * @param source Начало ребра.
+   * @param target Конец ребра.
+   */
+  void examineEdge(const VertexType& source, const VertexType& target) {}
+
+  /**
+   * @brief Метод, вызываемый при добавлении ребра в дерево поиска.
+   * @param source Начало ребра.
+   * @param target Конец ребра.
+   */
+  void treeEdge(const VertexType& source, const VertexType& target) {}
+
+  /**
+   * @brief Метод, вызываемый для обратного ребра поиска в глубину.
+   * @param source Начало ребра.
+   * @param target Предок source в дереве поиска.
+   */
+  void backEdge(const VertexType& source, const VertexType& target) {}
+
+  /**
+   * @brief Метод, вызываемый для прямого ребра поиска в глубину.
+   * @param source Начало ребра.
+   * @param target Уже завершённый потомок source.
+   */
+  void forwardEdge(const VertexType& source, const VertexType& target) {}
+
+  /**
+   * @brief Метод, вызываемый для перекрёстного ребра поиска в глубину.
+   * @param source Начало ребра.
+   * @param target Завершённая вершина другого поддерева.
+   */
+  void crossEdge(const VertexType& source, const VertexType& target) {}
+
+  /**
+   * @brief Метод, вызываемый при завершении обработки вершины.
+   * @param vertex Вершина, обработка которой завершена.
+   */
+  void finishVertex(const VertexType& vertex) {}
+};
+
+/**
+ * @brief Адаптер виртуального посетителя к статическому интерфейсу.
+ *
+ * Позволяет передавать в шаблонные обходы наследников Visitor: события
+ * пересылаются через виртуальные методы, а объект ребра создаётся только
+ * здесь.
+ *
+ * @tparam VertexType Тип вершины.
+ * @tparam EdgeType Тип ребра.
+ */
+template <typename VertexType, typename EdgeType>
+class VisitorAdapter {
+ public:
+  /**
+   * @brief Конструктор.
+   * @param visitor Виртуальный посетитель, которому пересылаются события.
+   */
+  explicit VisitorAdapter(Visitor<VertexType, EdgeType>& visitor)
+      : visitor(visitor) {}
+
+  /**
+   * @brief Пересылает обнаружение вершины.
+   */
+  void discoverVertex(const VertexType& vertex) {
+    visitor.discoverVertex(vertex);
+  }
+
+  /**
+   * @brief Пересылает посещение вершины.
+   */
+  void visitVertex(const VertexType& vertex) { visitor.visitVertex(vertex); }
+
+  /**
+   * @brief Пересылает исследование ребра.
+   */
+  void examineEdge(const VertexType& source, const VertexType& target) {
+    visitor.examineEdge(EdgeType(source, target));
+  }
+
+  /**
+   * @brief Пересылает добавление ребра в дерево поиска.
+   */
+  void treeEdge(const VertexType& source, const VertexType& target) {
+    visitor.treeEdge(EdgeType(source, target));
+  }
+
+  /**
+   * @brief Пересылает обратное ребро.
+   */
+  void backEdge(const VertexType& source, const VertexType& target) {
+    visitor.backEdge(EdgeType(source, target));
+  }
+
+  /**
+   * @brief Пересылает прямое ребро.
+   */
+  void forwardEdge(const VertexType& source, const VertexType& target) {
+    visitor.forwardEdge(EdgeType(source, target));
+  }
+
+  /**
+   * @brief Пересылает перекрёстное ребро.
+   */
+  void crossEdge(const VertexType& source, const VertexType& target) {
+    visitor.crossEdge(EdgeType(source, target));
+  }
+
+  /**
+   * @brief Пересылает завершение обработки вершины.
+   */
+  void finishVertex(const VertexType& vertex) { visitor.finishVertex(vertex); }
+
+ private:
+  Visitor<VertexType, EdgeType>& visitor;  ///< Виртуальный посетитель.
+};
+
 /**
  * @brief Реализация посетителя по умолчанию для алгоритма BFS.
  * @tparam VertexType Тип вершины.
@@ -6,31 +6,49 @@
 
 namespace graph {
 
+namespace {
+
+/**
+ * @brief Сравнение вершин по id для отсортированных списков соседей.
+ */
+struct VertexIdLess {
+  template <typename VertexType>
+  bool operator()(const VertexType& left, const VertexType& right) const {
+    return left.id < right.id;
+  }
+};
+
+}  // namespace
+
 template <typename VertexType, typename EdgeType>
 void AdjacencyListGraph<VertexType, EdgeType>::addVertex(
     const VertexType& vertex) {
   if (!this->hasVertex(vertex)) {
     this->vertices.emplace_back(vertex.id);
-    adjacencyList[vertex] =
-        std::vector<VertexType>();  // Инициализируем пустой список смежности
+    adjacencyList.insert(vertex);  // Инициализируем пустой список смежности
   }
 }
 
 template <typename VertexType, typename EdgeType>
 void AdjacencyListGraph<VertexType, EdgeType>::removeVertex(
     const VertexType& vertex) {
+  if (!adjacencyList.erase(vertex)) return;
+
   this->vertices.erase(
       std::remove_if(
           this->vertices.begin(), this->vertices.end(),
           [vertex](const VertexType& v) { return v.id == vertex.id; }),
       this->vertices.end());
 
-  adjacencyList.erase(vertex);
+  this->edges.erase(std::remove_if(this->edges.begin(), this->edges.end(),
+                                   [vertex](const EdgeType& e) {
+                                     return e.source.id == vertex.id ||
+                                            e.target.id == vertex.id;
+                                   }),
+                    this->edges.end());
 
-  for (auto& [vertex, neighbors] : adjacencyList) {
-    neighbors.erase(std::remove(neighbors.begin(), neighbors.end(), vertex),
-                    neighbors.end());
-  }
+  // Удаляем вершину из списков смежности остальных вершин
+  adjacencyList.removeNeighborEverywhere(vertex);
 }
 
 template <typename VertexType, typename EdgeType>
@@ -39,9 +57,20 @@ void AdjacencyListGraph<VertexType, EdgeType>::addEdge(const VertexType& source,
                                                        int capacity) {
   if (this->hasVertex(source) && this->hasVertex(target) &&
       !this->hasEdge(source, target)) {
-    this->edges.emplace_back(Edge(Vertex(source.id), Vertex(target.id)));
-    adjacencyList[source].push_back(
-        target);  // Добавляем target в список смежности source
+    this->edges.emplace_back(
+        Edge(Vertex(source.id), Vertex(target.id), capacity));
+    size_t slot = adjacencyList.find(source);
+    if (sortedNeighbors) {
+      auto neighbors = adjacencyList.neighbors(slot);
+      size_t position =
+          std::lower_bound(neighbors.begin(), neighbors.end(), target,
+                           VertexIdLess{}) -
+          neighbors.begin();
+      adjacencyList.insertNeighbor(slot, position, target);
+    } else {
+      adjacencyList.pushNeighbor(
+          slot, target);  // Добавляем target в список смежности source
+    }
   }
 }
 
@@ -56,24 +85,27 @@ void AdjacencyListGraph<VertexType, EdgeType>::removeEdge(
                     this->edges.end());
 
   // Удаляем target из списка смежности source
-  auto& neighbors = adjacencyList[source];
-  neighbors.erase(std::remove(neighbors.begin(), neighbors.end(), target),
-                  neighbors.end());
+  size_t slot = adjacencyList.find(source);
+  if (slot != adjacencyList.npos) {
+    adjacencyList.removeNeighbor(slot, target);
+  }
 }
 
 template <typename VertexType, typename EdgeType>
-typename std::vector<VertexType>::iterator
+typename std::pmr::vector<VertexType>::iterator
 AdjacencyListGraph<VertexType, EdgeType>::getNeighborsIterator(
     const VertexType& vertexId) {
-  return adjacencyList[vertexId].begin();
+  size_t slot = adjacencyList.find(vertexId);
+  if (slot == adjacencyList.npos) return adjacencyList.slabEnd();
+  return adjacencyList.neighborsBegin(slot);
 }
 
 template <typename VertexType, typename EdgeType>
-typename std::vector<VertexType>::iterator
+typename std::pmr::vector<VertexType>::iterator
 AdjacencyListGraph<VertexType, EdgeType>::getFilteredNeighborsIterator(
     const VertexType& vertexId, bool (*filter)(VertexType)) {
-  auto filteredNeighbors = std::make_unique<std::vector<VertexType>>();
-  for (auto& neighbor : adjacencyList[vertexId]) {
+  auto filteredNeighbors = std::make_unique<std::pmr::vector<VertexType>>();
+  for (const auto& neighbor : getNeighbors(vertexId)) {
     if (filter(neighbor)) {
       filteredNeighbors->push_back(neighbor);
     }
@@ -82,22 +114,27 @@ AdjacencyListGraph<VertexType, EdgeType>::getFilteredNeighborsIterator(
 }
 
 template <typename VertexType, typename EdgeType>
-const std::unordered_map<VertexType, std::vector<VertexType>>&
-AdjacencyListGraph<VertexType, EdgeType>::getAdjacencyList() {
-  return adjacencyList;
+AdjacencyMapView<VertexType>
+AdjacencyListGraph<VertexType, EdgeType>::getAdjacencyList() const {
+  return AdjacencyMapView<VertexType>(adjacencyList);
 }
 
 template <typename VertexType, typename EdgeType>
 bool AdjacencyListGraph<VertexType, EdgeType>::hasVertex(
     const VertexType& id) const {
-  return adjacencyList.find(id) != adjacencyList.end();
+  return adjacencyList.find(id) != adjacencyList.npos;
 }
 
 template <typename VertexType, typename EdgeType>
 bool AdjacencyListGraph<VertexType, EdgeType>::hasEdge(
     const VertexType& source, const VertexType& target) const {
-  if (!hasVertex(source)) return false;
-  const auto& neighbors = adjacencyList.at(source);
+  size_t slot = adjacencyList.find(source);
+  if (slot == adjacencyList.npos) return false;
+  auto neighbors = adjacencyList.neighbors(slot);
+  if (sortedNeighbors) {
+    return std::binary_search(neighbors.begin(), neighbors.end(), target,
+                              VertexIdLess{});
+  }
   return std::find(neighbors.begin(), neighbors.end(), target) !=
          neighbors.end();
 }
@@ -105,7 +142,31 @@ template <typename VertexType, typename EdgeType>
 std::vector<VertexType>
 AdjacencyListGraph<VertexType, EdgeType>::getAdjacencyVertices(
     const VertexType& vertex) {
-  return adjacencyList[vertex];
+  auto neighbors = getNeighbors(vertex);
+  return std::vector<VertexType>(neighbors.begin(), neighbors.end());
+}
+
+template <typename VertexType, typename EdgeType>
+void AdjacencyListGraph<VertexType, EdgeType>::setSortedNeighbors(
+    bool sorted) {
+  if (sorted && !sortedNeighbors) {
+    adjacencyList.sortAllNeighbors(VertexIdLess{});
+  }
+  sortedNeighbors = sorted;
+}
+
+template <typename VertexType, typename EdgeType>
+bool AdjacencyListGraph<VertexType, EdgeType>::hasSortedNeighbors() const {
+  return sortedNeighbors;
+}
+
+template <typename VertexType, typename EdgeType>
+NeighborRange<VertexType>
+AdjacencyListGraph<VertexType, EdgeType>::getNeighbors(
+    const VertexType& vertex) const {
+  size_t slot = adjacencyList.find(vertex);
+  if (slot == adjacencyList.npos) return NeighborRange<VertexType>(nullptr, 0);
+  return adjacencyList.neighbors(slot);
 }
 }  // namespace graph
 
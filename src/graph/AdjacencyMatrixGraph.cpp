@@ -12,6 +12,25 @@ size_t AdjacencyMatrixGraph<VertexType, EdgeType>::getVertexIndex(
   throw std::out_of_range("Vertex not found");
 }
 
+template <typename VertexType, typename EdgeType>
+bool AdjacencyMatrixGraph<VertexType, EdgeType>::testBit(size_t row,
+                                                         size_t column) const {
+  return (adjacencyMatrix[row][column / kWordBits] >> (column % kWordBits)) &
+         1u;
+}
+
+template <typename VertexType, typename EdgeType>
+void AdjacencyMatrixGraph<VertexType, EdgeType>::assignBit(size_t row,
+                                                           size_t column,
+                                                           bool value) {
+  uint64_t mask = uint64_t{1} << (column % kWordBits);
+  if (value) {
+    adjacencyMatrix[row][column / kWordBits] |= mask;
+  } else {
+    adjacencyMatrix[row][column / kWordBits] &= ~mask;
+  }
+}
+
 template <typename VertexType, typename EdgeType>
 void AdjacencyMatrixGraph<VertexType, EdgeType>::addVertex(
     const VertexType& id) {
@@ -21,14 +40,16 @@ void AdjacencyMatrixGraph<VertexType, EdgeType>::addVertex(
     // Добавляем новую вершину в матрицу смежности
     size_t newIndex = adjacencyMatrix.size();
     vertexToIndex[id] = newIndex;
-    indexToVertex[newIndex] = id;
+    indexToVertex.push_back(id);
 
-    // Расширяем матрицу смежности
-    for (auto& row : adjacencyMatrix) {
-      row.push_back(false);  // Добавляем новый столбец
+    // Новое слово в строках нужно только при переходе через границу слова
+    size_t words = newIndex / kWordBits + 1;
+    if (newIndex % kWordBits == 0) {
+      for (auto& row : adjacencyMatrix) {
+        row.push_back(0);  // Добавляем новое слово столбцов
+      }
     }
-    adjacencyMatrix.push_back(
-        std::vector<bool>(newIndex + 1, false));  // Добавляем новую строку
+    adjacencyMatrix.emplace_back(words, 0);  // Добавляем новую строку
   }
 }
 
@@ -44,19 +65,41 @@ void AdjacencyMatrixGraph<VertexType, EdgeType>::removeVertex(
                        [id](const VertexType& v) { return v.id == id.id; }),
         this->vertices.end());
 
-    // Удаляем строку и столбец из матрицы смежности
-    adjacencyMatrix.erase(adjacencyMatrix.begin() + index);
-    for (auto& row : adjacencyMatrix) {
-      row.erase(row.begin() + index);
+    // Удаляем инцидентные рёбра из списка рёбер
+    this->edges.erase(std::remove_if(this->edges.begin(), this->edges.end(),
+                                     [id](const EdgeType& e) {
+                                       return e.source.id == id.id ||
+                                              e.target.id == id.id;
+                                     }),
+                      this->edges.end());
+
+    // Переносим последнюю вершину на место удаляемой
+    size_t last = adjacencyMatrix.size() - 1;
+    if (index != last) {
+      adjacencyMatrix[index] = std::move(adjacencyMatrix[last]);
+    }
+    adjacencyMatrix.pop_back();
+
+    // Переносим столбец последней вершины и сужаем строки, если освободилось
+    // целое слово
+    bool shrink = last % kWordBits == 0;
+    for (size_t row = 0; row < adjacencyMatrix.size(); ++row) {
+      if (index != last) {
+        assignBit(row, index, testBit(row, last));
+      }
+      assignBit(row, last, false);
+      if (shrink) {
+        adjacencyMatrix[row].pop_back();
+      }
     }
 
-    // Обновляем индексы оставшихся вершин
+    // Обновляем соответствие индексов и вершин
     vertexToIndex.erase(id);
-    for (auto& [vertexId, vertexIndex] : vertexToIndex) {
-      if (vertexIndex > index) {
-        vertexIndex--;
-      }
+    if (index != last) {
+      indexToVertex[index] = indexToVertex[last];
+      vertexToIndex[indexToVertex[index]] = index;
     }
+    indexToVertex.pop_back();
   }
 }
 
@@ -64,10 +107,10 @@ template <typename VertexType, typename EdgeType>
 void AdjacencyMatrixGraph<VertexType, EdgeType>::addEdge(
     const VertexType& source, const VertexType& target, int capacity) {
   if (hasVertex(source) && hasVertex(target) && !hasEdge(source, target)) {
-    this->edges.emplace_back(source, target);
+    this->edges.emplace_back(source, target, capacity);
     size_t sourceIndex = getVertexIndex(source);
     size_t targetIndex = getVertexIndex(target);
-    adjacencyMatrix[sourceIndex][targetIndex] = true;
+    assignBit(sourceIndex, targetIndex, true);
   }
 }
 
@@ -84,20 +127,20 @@ void AdjacencyMatrixGraph<VertexType, EdgeType>::removeEdge(
 
     size_t sourceIndex = getVertexIndex(source);
     size_t targetIndex = getVertexIndex(target);
-    adjacencyMatrix[sourceIndex][targetIndex] = false;
+    assignBit(sourceIndex, targetIndex, false);
   }
 }
 
 template <typename VertexType, typename EdgeType>
-typename std::vector<VertexType>::iterator
+typename std::pmr::vector<VertexType>::iterator
 AdjacencyMatrixGraph<VertexType, EdgeType>::getNeighborsIterator(
     const VertexType& vertexId) {
-  std::vector<Vertex> neighbors;
+  std::pmr::vector<VertexType> neighbors;
   neighbors.clear();
   if (hasVertex(vertexId)) {
     size_t index = getVertexIndex(vertexId);
-    for (size_t i = 0; i < adjacencyMatrix[index].size(); ++i) {
-      if (adjacencyMatrix[index][i]) {
+    for (size_t i = 0; i < adjacencyMatrix.size(); ++i) {
+      if (testBit(index, i)) {
         neighbors.push_back(indexToVertex[i]);
       }
     }
@@ -106,15 +149,15 @@ AdjacencyMatrixGraph<VertexType, EdgeType>::getNeighborsIterator(
 }
 
 template <typename VertexType, typename EdgeType>
-typename std::vector<VertexType>::iterator
+typename std::pmr::vector<VertexType>::iterator
 AdjacencyMatrixGraph<VertexType, EdgeType>::getFilteredNeighborsIterator(
     const VertexType& vertexId, bool (*filter)(VertexType)) {
-  static std::vector<Vertex> filteredNeighbors;
+  static std::pmr::vector<VertexType> filteredNeighbors;
   filteredNeighbors.clear();
   if (hasVertex(vertexId)) {
     size_t index = getVertexIndex(vertexId);
-    for (size_t i = 0; i < adjacencyMatrix[index].size(); ++i) {
-      if (adjacencyMatrix[index][i] && filter(indexToVertex[i])) {
+    for (size_t i = 0; i < adjacencyMatrix.size(); ++i) {
+      if (testBit(index, i) && filter(indexToVertex[i])) {
         filteredNeighbors.push_back(indexToVertex[i]);
       }
     }
@@ -134,21 +177,43 @@ bool AdjacencyMatrixGraph<VertexType, EdgeType>::hasEdge(
   if (!hasVertex(source) || !hasVertex(target)) return false;
   size_t sourceIndex = getVertexIndex(source);
   size_t targetIndex = getVertexIndex(target);
-  return adjacencyMatrix[sourceIndex][targetIndex];
+  return testBit(sourceIndex, targetIndex);
 }
 template <typename VertexType, typename EdgeType>
 std::vector<VertexType>
 AdjacencyMatrixGraph<VertexType, EdgeType>::getAdjacencyVertices(
     const VertexType& vertex) {
   std::vector<VertexType> adjacencyEdges;
-  for (int i = 0; i < adjacencyMatrix[vertex.id - 1].size(); i++) {
-    if (adjacencyMatrix[vertex.id - 1][i]) {
-      adjacencyEdges.push_back(Vertex(i + 1));
+  if (!hasVertex(vertex)) return adjacencyEdges;
+  const auto& row = adjacencyMatrix[getVertexIndex(vertex)];
+  for (size_t word = 0; word < row.size(); ++word) {
+    // Перебираем только установленные биты слова
+    for (uint64_t bits = row[word]; bits != 0; bits &= bits - 1) {
+      size_t i = word * kWordBits + __builtin_ctzll(bits);
+      adjacencyEdges.push_back(indexToVertex.at(i));
     }
   }
   return adjacencyEdges;
 }
 
+template <typename VertexType, typename EdgeType>
+size_t AdjacencyMatrixGraph<VertexType, EdgeType>::getMatrixSize() const {
+  return adjacencyMatrix.size();
+}
+
+template <typename VertexType, typename EdgeType>
+const std::pmr::vector<uint64_t>&
+AdjacencyMatrixGraph<VertexType, EdgeType>::getAdjacencyRow(
+    size_t index) const {
+  return adjacencyMatrix.at(index);
+}
+
+template <typename VertexType, typename EdgeType>
+const VertexType& AdjacencyMatrixGraph<VertexType, EdgeType>::getVertexByIndex(
+    size_t index) const {
+  return indexToVertex.at(index);
+}
+
 }  // namespace graph
 
 template class graph::AdjacencyMatrixGraph<graph::Vertex, graph::Edge>;
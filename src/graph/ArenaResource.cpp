@@ -0,0 +1,96 @@
+#include "../../include/graph/ArenaResource.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace graph {
+
+ArenaResource::ArenaResource(size_t initialBlockSize,
+                             std::pmr::memory_resource* upstream)
+    : upstream(upstream),
+      nextBlockSize(std::max(initialBlockSize, 2 * sizeof(Block))) {}
+
+ArenaResource::~ArenaResource() { release(); }
+
+void ArenaResource::release() {
+  while (blocks != nullptr) {
+    Block* next = blocks->next;
+    reserved -= blocks->size;
+    upstream->deallocate(blocks, blocks->size, alignof(std::max_align_t));
+    blocks = next;
+  }
+  cursor = limit = nullptr;
+  allocated = 0;
+}
+
+void ArenaResource::reset() {
+  if (blocks == nullptr) return;
+
+  // Оставляем наибольший блок, остальные возвращаем источнику
+  Block* largest = blocks;
+  for (Block* block = blocks->next; block != nullptr; block = block->next) {
+    if (block->size > largest->size) largest = block;
+  }
+  Block* block = blocks;
+  while (block != nullptr) {
+    Block* next = block->next;
+    if (block != largest) {
+      reserved -= block->size;
+      upstream->deallocate(block, block->size, alignof(std::max_align_t));
+    }
+    block = next;
+  }
+  largest->next = nullptr;
+  blocks = largest;
+  cursor = reinterpret_cast<char*>(largest) + sizeof(Block);
+  limit = reinterpret_cast<char*>(largest) + largest->size;
+  allocated = 0;
+}
+
+size_t ArenaResource::bytesAllocated() const { return allocated; }
+
+size_t ArenaResource::bytesReserved() const { return reserved; }
+
+std::pmr::memory_resource* ArenaResource::getUpstream() const {
+  return upstream;
+}
+
+void* ArenaResource::do_allocate(size_t bytes, size_t alignment) {
+  auto address = reinterpret_cast<uintptr_t>(cursor);
+  uintptr_t aligned = (address + alignment - 1) & ~(uintptr_t{alignment} - 1);
+  if (cursor == nullptr ||
+      aligned + bytes > reinterpret_cast<uintptr_t>(limit)) {
+    allocateBlock(bytes, alignment);
+    address = reinterpret_cast<uintptr_t>(cursor);
+    aligned = (address + alignment - 1) & ~(uintptr_t{alignment} - 1);
+  }
+  cursor = reinterpret_cast<char*>(aligned + bytes);
+  allocated += bytes;
+  return reinterpret_cast<void*>(aligned);
+}
+
+void ArenaResource::do_deallocate(void*, size_t, size_t) {
+  // Память возвращается только целыми блоками в release() и reset()
+}
+
+bool ArenaResource::do_is_equal(
+    const std::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+void ArenaResource::allocateBlock(size_t bytes, size_t alignment) {
+  size_t required = sizeof(Block) + bytes + alignment;
+  size_t size = std::max(nextBlockSize, required);
+  void* memory = upstream->allocate(size, alignof(std::max_align_t));
+
+  Block* block = static_cast<Block*>(memory);
+  block->next = blocks;
+  block->size = size;
+  blocks = block;
+  cursor = static_cast<char*>(memory) + sizeof(Block);
+  limit = static_cast<char*>(memory) + size;
+  reserved += size;
+  nextBlockSize = size * 2;
+}
+
+}  // namespace graph
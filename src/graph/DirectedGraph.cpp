@@ -8,7 +8,7 @@ void DirectedGraph<VertexType, EdgeType>::addEdge(const VertexType& source,
                                                   int capacity) {
   if (this->hasVertex(source) && this->hasVertex(target) &&
       !this->hasEdge(source, target)) {
-    this->edges.emplace_back(source, target);
+    this->edges.emplace_back(source, target, capacity);
   }
 }
 
@@ -33,10 +33,10 @@ bool DirectedGraph<VertexType, EdgeType>::hasEdge(
 }
 
 template <typename VertexType, typename EdgeType>
-typename std::vector<VertexType>::iterator
+typename std::pmr::vector<VertexType>::iterator
 DirectedGraph<VertexType, EdgeType>::getNeighborsIterator(
     const VertexType& vertexId) {
-  std::vector<VertexType> neighbors;
+  std::pmr::vector<VertexType> neighbors;
   neighbors.clear();
   if (this->hasVertex(vertexId)) {
     for (const auto& edge : this->edges) {
@@ -49,10 +49,10 @@ DirectedGraph<VertexType, EdgeType>::getNeighborsIterator(
 }
 
 template <typename VertexType, typename EdgeType>
-typename std::vector<VertexType>::iterator
+typename std::pmr::vector<VertexType>::iterator
 DirectedGraph<VertexType, EdgeType>::getFilteredNeighborsIterator(
     const VertexType& vertexId, bool (*filter)(VertexType)) {
-  std::vector<VertexType> filteredNeighbors;
+  std::pmr::vector<VertexType> filteredNeighbors;
   filteredNeighbors.clear();
   if (this->hasVertex(vertexId)) {
     for (const auto& edge : this->edges) {
@@ -36,7 +36,7 @@ void EdgeListGraph<VertexType, EdgeType>::addEdge(const VertexType& source,
                                                   const VertexType& target,
                                                   int capacity) {
   if (hasVertex(source) && hasVertex(target) && !hasEdge(source, target)) {
-    this->edges.emplace_back(source, target);
+    this->edges.emplace_back(source, target, capacity);
   }
 }
 
@@ -52,10 +52,10 @@ void EdgeListGraph<VertexType, EdgeType>::removeEdge(const VertexType& source,
 }
 
 template <typename VertexType, typename EdgeType>
-typename std::vector<VertexType>::iterator
+typename std::pmr::vector<VertexType>::iterator
 EdgeListGraph<VertexType, EdgeType>::getNeighborsIterator(
     const VertexType& vertexId) {
-  std::vector<VertexType> neighbors;
+  std::pmr::vector<VertexType> neighbors;
   neighbors.clear();
   if (hasVertex(vertexId)) {
     for (const auto& edge : this->edges) {
@@ -68,10 +68,10 @@ EdgeListGraph<VertexType, EdgeType>::getNeighborsIterator(
 }
 
 template <typename VertexType, typename EdgeType>
-typename std::vector<VertexType>::iterator
+typename std::pmr::vector<VertexType>::iterator
 EdgeListGraph<VertexType, EdgeType>::getFilteredNeighborsIterator(
     const VertexType& vertexId, bool (*filter)(VertexType)) {
-  std::vector<VertexType> filteredNeighbors;
+  std::pmr::vector<VertexType> filteredNeighbors;
   filteredNeighbors.clear();
   if (hasVertex(vertexId)) {
     for (const auto& edge : this->edges) {
@@ -47,20 +47,25 @@ void Graph<VertexType, EdgeType>::removeEdge(const VertexType& source,
 }
 
 template <typename VertexType, typename EdgeType>
-const std::vector<VertexType>& Graph<VertexType, EdgeType>::getVertices()
-    const {
-  return vertices;
+VectorView<VertexType> Graph<VertexType, EdgeType>::getVertices() const {
+  return VectorView<VertexType>(vertices);
 }
 
 template <typename VertexType, typename EdgeType>
-const std::vector<EdgeType>& Graph<VertexType, EdgeType>::getEdges() const {
-  return edges;
+VectorView<EdgeType> Graph<VertexType, EdgeType>::getEdges() const {
+  return VectorView<EdgeType>(edges);
+}
+
+template <typename VertexType, typename EdgeType>
+std::pmr::memory_resource* Graph<VertexType, EdgeType>::getMemoryResource()
+    const {
+  return vertices.get_allocator().resource();
 }
 
 template <typename VertexType, typename EdgeType>
-typename std::vector<VertexType>::iterator
+typename std::pmr::vector<VertexType>::iterator
 Graph<VertexType, EdgeType>::getNeighborsIterator(const VertexType& vertexId) {
-  std::vector<Vertex> neighbors;
+  std::pmr::vector<VertexType> neighbors;
   neighbors.clear();
   for (const auto& edge : edges) {
     if (edge.source == vertexId) {
@@ -71,10 +76,10 @@ Graph<VertexType, EdgeType>::getNeighborsIterator(const VertexType& vertexId) {
 }
 
 template <typename VertexType, typename EdgeType>
-typename std::vector<VertexType>::iterator
+typename std::pmr::vector<VertexType>::iterator
 Graph<VertexType, EdgeType>::getFilteredNeighborsIterator(
     const VertexType& vertexId, bool (*filter)(VertexType)) {
-  std::vector<Vertex> filteredNeighbors;
+  std::pmr::vector<VertexType> filteredNeighbors;
   filteredNeighbors.clear();
   for (const auto& edge : edges) {
     if (edge.source == vertexId && filter(edge.target)) {
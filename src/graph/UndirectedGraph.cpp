@@ -1,7 +1,26 @@
 #include "../../include/graph/UndirectedGraph.h"
 
+#include <stdexcept>
+#include <utility>
+
 namespace graph {
 
+template <typename VertexType, typename EdgeType>
+void UndirectedGraph<VertexType, EdgeType>::addVertex(
+    const VertexType& vertex) {
+  if (this->hasVertex(vertex)) return;
+  Graph<VertexType, EdgeType>::addVertex(vertex);
+  if (connectivity.enabled) addConnectivityVertex(vertex);
+}
+
+template <typename VertexType, typename EdgeType>
+void UndirectedGraph<VertexType, EdgeType>::removeVertex(
+    const VertexType& vertex) {
+  if (!this->hasVertex(vertex)) return;
+  Graph<VertexType, EdgeType>::removeVertex(vertex);
+  rebuildConnectivity();
+}
+
 template <typename VertexType, typename EdgeType>
 void UndirectedGraph<VertexType, EdgeType>::addEdge(const VertexType& source,
                                                     const VertexType& target,
@@ -9,8 +28,9 @@ void UndirectedGraph<VertexType, EdgeType>::addEdge(const VertexType& source,
   if (this->hasVertex(source) && this->hasVertex(target) &&
       !this->hasEdge(source, target)) {
     // Добавляем два ребра для неориентированного графа
-    this->edges.emplace_back(source, target);
-    this->edges.emplace_back(target, source);
+    this->edges.emplace_back(source, target, capacity);
+    this->edges.emplace_back(target, source, capacity);
+    if (connectivity.enabled) unite(source, target);
   }
 }
 
@@ -18,13 +38,16 @@ template <typename VertexType, typename EdgeType>
 void UndirectedGraph<VertexType, EdgeType>::removeEdge(
     const VertexType& source, const VertexType& target) {
   // Удаляем оба направления ребра
-  this->edges.erase(
+  auto removed =
       std::remove_if(this->edges.begin(), this->edges.end(),
                      [source, target](const EdgeType& e) {
                        return (e.source == source && e.target == target) ||
                               (e.source == target && e.target == source);
-                     }),
-      this->edges.end());
+                     });
+  if (removed == this->edges.end()) return;
+  this->edges.erase(removed, this->edges.end());
+  // Разделение компоненты объединениями не отменить — перестраиваем
+  rebuildConnectivity();
 }
 
 template <typename VertexType, typename EdgeType>
@@ -38,10 +61,10 @@ bool UndirectedGraph<VertexType, EdgeType>::hasEdge(
 }
 
 template <typename VertexType, typename EdgeType>
-typename std::vector<VertexType>::iterator
+typename std::pmr::vector<VertexType>::iterator
 UndirectedGraph<VertexType, EdgeType>::getNeighborsIterator(
     const VertexType& vertexId) {
-  std::vector<Vertex> neighbors;
+  std::pmr::vector<VertexType> neighbors;
   neighbors.clear();
   if (this->hasVertex(vertexId)) {
     for (const auto& edge : this->edges) {
@@ -54,10 +77,10 @@ UndirectedGraph<VertexType, EdgeType>::getNeighborsIterator(
 }
 
 template <typename VertexType, typename EdgeType>
-typename std::vector<VertexType>::iterator
+typename std::pmr::vector<VertexType>::iterator
 UndirectedGraph<VertexType, EdgeType>::getFilteredNeighborsIterator(
     const VertexType& vertexId, bool (*filter)(VertexType)) {
-  std::vector<Vertex> filteredNeighbors;
+  std::pmr::vector<VertexType> filteredNeighbors;
   filteredNeighbors.clear();
   if (this->hasVertex(vertexId)) {
     for (const auto& edge : this->edges) {
@@ -82,6 +105,124 @@ UndirectedGraph<VertexType, EdgeType>::getAdjacencyVertices(
   return neighbors;
 }
 
+template <typename VertexType, typename EdgeType>
+void UndirectedGraph<VertexType, EdgeType>::setConnectivityTracking(
+    bool track) {
+  connectivity.enabled = track;
+  if (track) {
+    rebuildConnectivity();
+  } else {
+    connectivity.index.clear();
+    connectivity.parent.clear();
+    connectivity.parent.shrink_to_fit();
+    connectivity.rank.clear();
+    connectivity.rank.shrink_to_fit();
+    connectivity.components = 0;
+  }
+}
+
+template <typename VertexType, typename EdgeType>
+bool UndirectedGraph<VertexType, EdgeType>::tracksConnectivity() const {
+  return connectivity.enabled;
+}
+
+template <typename VertexType, typename EdgeType>
+bool UndirectedGraph<VertexType, EdgeType>::connected(
+    const VertexType& a, const VertexType& b) const {
+  requireConnectivity();
+  auto first = connectivity.index.find(a);
+  auto second = connectivity.index.find(b);
+  if (first == connectivity.index.end() ||
+      second == connectivity.index.end()) {
+    throw std::out_of_range("Vertex not found");
+  }
+  return findRootReadOnly(first->second) == findRootReadOnly(second->second);
+}
+
+template <typename VertexType, typename EdgeType>
+size_t UndirectedGraph<VertexType, EdgeType>::componentCount() const {
+  requireConnectivity();
+  return connectivity.components;
+}
+
+template <typename VertexType, typename EdgeType>
+void UndirectedGraph<VertexType, EdgeType>::rebuildConnectivity() {
+  if (!connectivity.enabled) return;
+  connectivity.index.clear();
+  connectivity.parent.clear();
+  connectivity.rank.clear();
+  connectivity.components = 0;
+  connectivity.index.reserve(this->vertices.size());
+  connectivity.parent.reserve(this->vertices.size());
+  connectivity.rank.reserve(this->vertices.size());
+  for (const auto& v : this->vertices) {
+    addConnectivityVertex(v);
+  }
+  // Каждое ребро хранится дважды; повторное объединение ничего не меняет
+  for (const auto& e : this->edges) {
+    unite(e.source, e.target);
+  }
+}
+
+template <typename VertexType, typename EdgeType>
+void UndirectedGraph<VertexType, EdgeType>::requireConnectivity() const {
+  if (!connectivity.enabled) {
+    throw std::logic_error("Connectivity is not tracked");
+  }
+}
+
+template <typename VertexType, typename EdgeType>
+void UndirectedGraph<VertexType, EdgeType>::addConnectivityVertex(
+    const VertexType& vertex) {
+  auto next = static_cast<uint32_t>(connectivity.parent.size());
+  if (!connectivity.index.emplace(vertex, next).second) return;
+  connectivity.parent.push_back(next);
+  connectivity.rank.push_back(0);
+  ++connectivity.components;
+}
+
+template <typename VertexType, typename EdgeType>
+uint32_t UndirectedGraph<VertexType, EdgeType>::findRoot(uint32_t v) {
+  auto& parent = connectivity.parent;
+  uint32_t root = v;
+  while (parent[root] != root) {
+    root = parent[root];
+  }
+  while (parent[v] != root) {
+    v = std::exchange(parent[v], root);
+  }
+  return root;
+}
+
+template <typename VertexType, typename EdgeType>
+uint32_t UndirectedGraph<VertexType, EdgeType>::findRootReadOnly(
+    uint32_t v) const {
+  // Объединение по рангу ограничивает глубину дерева O(log V)
+  while (connectivity.parent[v] != v) {
+    v = connectivity.parent[v];
+  }
+  return v;
+}
+
+template <typename VertexType, typename EdgeType>
+void UndirectedGraph<VertexType, EdgeType>::unite(const VertexType& a,
+                                                  const VertexType& b) {
+  auto first = connectivity.index.find(a);
+  auto second = connectivity.index.find(b);
+  if (first == connectivity.index.end() ||
+      second == connectivity.index.end()) {
+    return;
+  }
+  uint32_t u = findRoot(first->second);
+  uint32_t v = findRoot(second->second);
+  if (u == v) return;
+  auto& rank = connectivity.rank;
+  if (rank[u] < rank[v]) std::swap(u, v);
+  connectivity.parent[v] = u;
+  if (rank[u] == rank[v]) ++rank[u];
+  --connectivity.components;
+}
+
 }  // namespace graph
 
 template class graph::UndirectedGraph<graph::Vertex, graph::Edge>;
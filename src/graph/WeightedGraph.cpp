@@ -54,10 +54,10 @@ void WeightedGraph<VertexType, WeightType>::setEdgeWeight(
 }
 
 template <typename VertexType, typename WeightType>
-typename std::vector<VertexType>::iterator
+typename std::pmr::vector<VertexType>::iterator
 WeightedGraph<VertexType, WeightType>::getNeighborsIterator(
     const VertexType& vertexId) {
-  std::vector<Vertex> neighbors;
+  std::pmr::vector<VertexType> neighbors;
   neighbors.clear();
   for (const auto& edge : this->edges) {
     if (edge.source == vertexId) {
@@ -68,10 +68,10 @@ WeightedGraph<VertexType, WeightType>::getNeighborsIterator(
 }
 
 template <typename VertexType, typename WeightType>
-typename std::vector<VertexType>::iterator
+typename std::pmr::vector<VertexType>::iterator
 WeightedGraph<VertexType, WeightType>::getFilteredNeighborsIterator(
     const VertexType& vertexId, bool (*filter)(VertexType)) {
-  std::vector<Vertex> filteredNeighbors;
+  std::pmr::vector<VertexType> filteredNeighbors;
   filteredNeighbors.clear();
   for (const auto& edge : this->edges) {
     if (edge.source == vertexId && filter(edge.target)) {
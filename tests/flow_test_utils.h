@@ -0,0 +1,136 @@
+#ifndef FLOW_TEST_UTILS_H
+#define FLOW_TEST_UTILS_H
+
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "../include/algorithms/flowNetwork/FlowNetwork.h"
+#include "../include/graph/DirectedGraph.h"
+#include "gtest/gtest.h"
+
+/**
+ * @brief Общие вспомогательные функции тестов потоковых алгоритмов.
+ */
+namespace flow_test {
+
+/// Дуга: откуда, куда, пропускная способность.
+using Arc = std::tuple<int, int, int>;
+
+/**
+ * @brief Строит сеть на вершинах 0..n-1 с заданными дугами.
+ */
+template <typename GraphType = graph::DirectedGraph<>>
+graph::FlowNetwork<GraphType> makeNetwork(int n,
+                                          const std::vector<Arc>& arcs) {
+  graph::FlowNetwork<GraphType> network;
+  for (int i = 0; i < n; ++i) {
+    network.addVertex(graph::Vertex(i));
+  }
+  for (const auto& [from, to, capacity] : arcs) {
+    network.addEdge(graph::Vertex(from), graph::Vertex(to), capacity);
+  }
+  return network;
+}
+
+/// Дуга со стоимостью: откуда, куда, пропускная способность, стоимость.
+using CostArc = std::tuple<int, int, int, int>;
+
+/**
+ * @brief Строит сеть на вершинах 0..n-1 с дугами, у которых задана стоимость.
+ */
+template <typename GraphType = graph::DirectedGraph<>>
+graph::FlowNetwork<GraphType> makeNetwork(int n,
+                                          const std::vector<CostArc>& arcs) {
+  graph::FlowNetwork<GraphType> network;
+  for (int i = 0; i < n; ++i) {
+    network.addVertex(graph::Vertex(i));
+  }
+  for (const auto& [from, to, capacity, cost] : arcs) {
+    network.addEdge(graph::Vertex(from), graph::Vertex(to), capacity, cost);
+  }
+  return network;
+}
+
+/**
+ * @brief Строит неориентированную сеть: каждое ребро в обе стороны.
+ */
+template <typename GraphType>
+graph::FlowNetwork<GraphType> makeUndirectedNetwork(
+    int n, const std::vector<Arc>& arcs) {
+  graph::FlowNetwork<GraphType> network;
+  for (int i = 0; i < n; ++i) {
+    network.addVertex(graph::Vertex(i));
+  }
+  for (const auto& [u, v, capacity] : arcs) {
+    network.addEdge(graph::Vertex(u), graph::Vertex(v), capacity);
+    network.addEdge(graph::Vertex(v), graph::Vertex(u), capacity);
+  }
+  return network;
+}
+
+/**
+ * @brief Случайные дуги без петель с пропускными способностями из
+ * [minCapacity, maxCapacity].
+ */
+inline std::vector<Arc> randomArcs(std::mt19937& rng, int n, int m,
+                                   int minCapacity, int maxCapacity) {
+  std::vector<Arc> arcs;
+  for (int i = 0; i < m; ++i) {
+    int from = static_cast<int>(rng() % n);
+    int to = static_cast<int>(rng() % n);
+    if (from == to) continue;
+    int spread = maxCapacity - minCapacity + 1;
+    arcs.emplace_back(from, to, minCapacity + static_cast<int>(rng() % spread));
+  }
+  return arcs;
+}
+
+/**
+ * @brief Проверяет, что на рёбрах лежит допустимый поток заданной величины:
+ * ограничения пропускных способностей, антисимметрия и сохранение потока.
+ */
+template <typename Network>
+void expectValidFlow(const Network& network, int s, int t, int value) {
+  std::vector<long long> balance(network.vertexCount(), 0);
+  for (size_t id = 0; id < network.edgeCount(); id += 2) {
+    const auto& e = network.getEdge(id);
+    ASSERT_GE(e.flow, 0);
+    ASSERT_LE(e.flow, e.capacity);
+    ASSERT_EQ(network.getEdge(Network::reverseEdge(id)).flow, -e.flow);
+    balance[network.getTail(id)] -= e.flow;
+    balance[e.target] += e.flow;
+  }
+  size_t si = network.getVertexIndex(graph::Vertex(s));
+  size_t ti = network.getVertexIndex(graph::Vertex(t));
+  for (size_t v = 0; v < balance.size(); ++v) {
+    long long expected = v == si ? -value : v == ti ? value : 0;
+    ASSERT_EQ(balance[v], expected) << "vertex " << v;
+  }
+}
+
+/**
+ * @brief Вершины, достижимые из истока в остаточной сети (сторона истока
+ * минимального разреза).
+ */
+template <typename Network>
+std::vector<char> sourceSide(const Network& network, int s) {
+  std::vector<char> reached(network.vertexCount(), 0);
+  std::vector<size_t> queue{network.getVertexIndex(graph::Vertex(s))};
+  reached[queue[0]] = 1;
+  for (size_t head = 0; head < queue.size(); ++head) {
+    for (uint32_t id : network.getArcs(queue[head])) {
+      const auto& e = network.getEdge(id);
+      if (e.residual() > 0 && !reached[e.target]) {
+        reached[e.target] = 1;
+        queue.push_back(e.target);
+      }
+    }
+  }
+  return reached;
+}
+
+}  // namespace flow_test
+
+#endif  // FLOW_TEST_UTILS_H
@@ -0,0 +1,40 @@
+#ifndef GRAPH_TEST_UTILS_H
+#define GRAPH_TEST_UTILS_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "../include/algorithms/bfs_dfs/AdjacencyView.h"
+
+/**
+ * @brief Общие вспомогательные функции тестов алгоритмов на AdjacencyView.
+ */
+namespace graph_test {
+
+/// Рёбра как пары индексов вершин.
+using EdgePairs = std::vector<std::pair<uint32_t, uint32_t>>;
+
+/**
+ * @brief Представление ориентированного графа с вершинами 0..n-1.
+ */
+inline graph::AdjacencyView<> makeView(uint32_t n, const EdgePairs& edges) {
+  std::vector<graph::Vertex> vertices;
+  for (uint32_t v = 0; v < n; ++v) {
+    vertices.emplace_back(static_cast<int>(v));
+  }
+  return graph::AdjacencyView<>(std::move(vertices), edges);
+}
+
+/**
+ * @brief Симметричное представление графа с вершинами 0..n-1: каждое ребро
+ * в обе стороны.
+ */
+inline graph::AdjacencyView<> makeSymmetricView(uint32_t n,
+                                                const EdgePairs& edges) {
+  return makeView(n, edges).symmetrize();
+}
+
+}  // namespace graph_test
+
+#endif  // GRAPH_TEST_UTILS_H
@@ -1,4 +1,7 @@
 #include <iostream>
+#include <random>
+#include <set>
+#include <unordered_map>
 
 #include "../include/graph/AdjacencyListGraph.h"
 #include "gtest/gtest.h"
@@ -119,4 +122,140 @@ TEST(AdjacencyListGraphTest, LargeGraph) {
   EXPECT_TRUE(graph.hasEdge(graph::Vertex(0), graph::Vertex(1)));
   EXPECT_FALSE(graph.hasEdge(graph::Vertex(999), graph::Vertex(998)));
   EXPECT_FALSE(graph.hasEdge(graph::Vertex(0), graph::Vertex(999)));
-}
\ No newline at end of file
+}
+
+TEST(AdjacencyListGraphTest, SortedNeighbors) {
+  graph::AdjacencyListGraph<graph::Vertex, graph::Edge> graph(true);
+  for (int i = 1; i <= 5; ++i) {
+    graph.addVertex(graph::Vertex(i));
+  }
+  graph.addEdge(graph::Vertex(1), graph::Vertex(4));
+  graph.addEdge(graph::Vertex(1), graph::Vertex(2));
+  graph.addEdge(graph::Vertex(1), graph::Vertex(5));
+  graph.addEdge(graph::Vertex(1), graph::Vertex(3));
+  graph.addEdge(graph::Vertex(1), graph::Vertex(2));
+
+  const auto& neighbors = graph.getNeighbors(graph::Vertex(1));
+  ASSERT_EQ(neighbors.size(), 4u);
+  for (size_t i = 0; i < neighbors.size(); ++i) {
+    EXPECT_EQ(neighbors[i].id, static_cast<int>(i) + 2);
+  }
+  EXPECT_TRUE(graph.hasEdge(graph::Vertex(1), graph::Vertex(3)));
+  EXPECT_FALSE(graph.hasEdge(graph::Vertex(3), graph::Vertex(1)));
+
+  graph.removeEdge(graph::Vertex(1), graph::Vertex(3));
+  EXPECT_FALSE(graph.hasEdge(graph::Vertex(1), graph::Vertex(3)));
+  EXPECT_TRUE(graph.hasEdge(graph::Vertex(1), graph::Vertex(4)));
+}
+
+TEST(AdjacencyListGraphTest, EnableSortedNeighborsLater) {
+  graph::AdjacencyListGraph<graph::Vertex, graph::Edge> graph;
+  for (int i = 1; i <= 4; ++i) {
+    graph.addVertex(graph::Vertex(i));
+  }
+  graph.addEdge(graph::Vertex(1), graph::Vertex(4));
+  graph.addEdge(graph::Vertex(1), graph::Vertex(2));
+  EXPECT_FALSE(graph.hasSortedNeighbors());
+
+  graph.setSortedNeighbors(true);
+  EXPECT_TRUE(graph.hasSortedNeighbors());
+  EXPECT_EQ(graph.getNeighbors(graph::Vertex(1)).front().id, 2);
+  graph.addEdge(graph::Vertex(1), graph::Vertex(3));
+  EXPECT_EQ(graph.getNeighbors(graph::Vertex(1))[1].id, 3);
+  EXPECT_TRUE(graph.getNeighbors(graph::Vertex(7)).empty());
+}
+
+TEST(AdjacencyListGraphTest, RemoveVertexClearsIncomingEdges) {
+  graph::AdjacencyListGraph<graph::Vertex, graph::Edge> graph;
+  graph.addVertex(graph::Vertex(1));
+  graph.addVertex(graph::Vertex(2));
+  graph.addVertex(graph::Vertex(3));
+  graph.addEdge(graph::Vertex(1), graph::Vertex(2));
+  graph.addEdge(graph::Vertex(3), graph::Vertex(2));
+  graph.addEdge(graph::Vertex(3), graph::Vertex(1));
+
+  graph.removeVertex(graph::Vertex(2));
+  EXPECT_FALSE(graph.hasEdge(graph::Vertex(1), graph::Vertex(2)));
+  EXPECT_FALSE(graph.hasEdge(graph::Vertex(3), graph::Vertex(2)));
+  EXPECT_TRUE(graph.hasEdge(graph::Vertex(3), graph::Vertex(1)));
+  EXPECT_EQ(graph.getEdges().size(), 1u);
+
+  graph.addVertex(graph::Vertex(2));
+  EXPECT_TRUE(graph.getNeighbors(graph::Vertex(2)).empty());
+  EXPECT_EQ(graph.getAdjacencyList().size(), 3u);
+}
+
+TEST(AdjacencyListGraphTest, RandomOperationsMatchReference) {
+  graph::AdjacencyListGraph<graph::Vertex, graph::Edge> graph;
+  std::unordered_map<int, std::set<int>> reference;
+  std::mt19937 rng(7);
+  const int n = 300;
+  for (int step = 0; step < 20000; ++step) {
+    int u = static_cast<int>(rng() % n);
+    int v = static_cast<int>(rng() % n);
+    switch (rng() % 10) {
+      case 0:
+        graph.removeVertex(graph::Vertex(u));
+        if (reference.erase(u)) {
+          for (auto& [w, neighbors] : reference) neighbors.erase(u);
+        }
+        break;
+      case 1:
+      case 2:
+        graph.removeEdge(graph::Vertex(u), graph::Vertex(v));
+        if (reference.count(u)) reference[u].erase(v);
+        break;
+      default:
+        graph.addVertex(graph::Vertex(u));
+        graph.addVertex(graph::Vertex(v));
+        graph.addEdge(graph::Vertex(u), graph::Vertex(v));
+        reference[u].insert(v);
+        reference[v];
+        break;
+    }
+  }
+
+  auto adjacency = graph.getAdjacencyList();
+  ASSERT_EQ(adjacency.size(), reference.size());
+  for (const auto& [u, neighbors] : reference) {
+    ASSERT_TRUE(graph.hasVertex(graph::Vertex(u)));
+    std::set<int> actual;
+    for (const auto& w : graph.getNeighbors(graph::Vertex(u))) {
+      actual.insert(w.id);
+    }
+    EXPECT_EQ(actual, neighbors);
+    EXPECT_EQ(graph.getNeighbors(graph::Vertex(u)).size(), neighbors.size());
+  }
+}
+
+TEST(AdjacencyListGraphTest, AdjacencyListViewDoesNotCopy) {
+  graph::AdjacencyListGraph<graph::Vertex, graph::Edge> graph;
+  for (int i = 1; i <= 3; ++i) {
+    graph.addVertex(graph::Vertex(i));
+  }
+  graph.addEdge(graph::Vertex(1), graph::Vertex(2));
+  graph.addEdge(graph::Vertex(1), graph::Vertex(3));
+
+  auto adjacency = graph.getAdjacencyList();
+  EXPECT_EQ(adjacency.size(), 3u);
+  EXPECT_EQ(adjacency.count(graph::Vertex(1)), 1u);
+  EXPECT_EQ(adjacency.count(graph::Vertex(4)), 0u);
+  EXPECT_EQ(adjacency.at(graph::Vertex(1)).data(),
+            graph.getNeighbors(graph::Vertex(1)).data());
+  EXPECT_THROW(adjacency.at(graph::Vertex(4)), std::out_of_range);
+
+  size_t vertices = 0;
+  size_t edges = 0;
+  for (const auto& [vertex, neighbors] : adjacency) {
+    EXPECT_TRUE(graph.hasVertex(vertex));
+    ++vertices;
+    edges += neighbors.size();
+  }
+  EXPECT_EQ(vertices, 3u);
+  EXPECT_EQ(edges, 2u);
+
+  std::unordered_map<graph::Vertex, std::vector<graph::Vertex>> copy =
+      graph.getAdjacencyList();
+  EXPECT_EQ(copy.at(graph::Vertex(1)).size(), 2u);
+  EXPECT_TRUE(copy.at(graph::Vertex(3)).empty());
+}
@@ -96,4 +96,58 @@ TEST(AdjacencyMatrixGraphTest, LargeGraph) {
   EXPECT_TRUE(graph.hasEdge(graph::Vertex(0), graph::Vertex(1)));
   EXPECT_FALSE(graph.hasEdge(graph::Vertex(99), graph::Vertex(98)));
   EXPECT_FALSE(graph.hasEdge(graph::Vertex(0), graph::Vertex(99)));
-}
\ No newline at end of file
+}
+
+TEST(AdjacencyMatrixGraphTest, RemoveVertexKeepsOtherEdges) {
+  graph::AdjacencyMatrixGraph<graph::Vertex, graph::Edge> graph;
+  for (int i = 1; i <= 4; ++i) {
+    graph.addVertex(graph::Vertex(i));
+  }
+  graph.addEdge(graph::Vertex(1), graph::Vertex(4));
+  graph.addEdge(graph::Vertex(4), graph::Vertex(3));
+  graph.addEdge(graph::Vertex(4), graph::Vertex(4));
+  graph.addEdge(graph::Vertex(4), graph::Vertex(2));
+  graph.addEdge(graph::Vertex(2), graph::Vertex(3));
+
+  graph.removeVertex(graph::Vertex(2));
+  EXPECT_EQ(graph.getMatrixSize(), 3u);
+  EXPECT_EQ(graph.getVertexByIndex(1), graph::Vertex(4));
+  EXPECT_TRUE(graph.hasEdge(graph::Vertex(1), graph::Vertex(4)));
+  EXPECT_TRUE(graph.hasEdge(graph::Vertex(4), graph::Vertex(3)));
+  EXPECT_TRUE(graph.hasEdge(graph::Vertex(4), graph::Vertex(4)));
+  EXPECT_FALSE(graph.hasEdge(graph::Vertex(4), graph::Vertex(1)));
+  EXPECT_EQ(graph.getAdjacencyVertices(graph::Vertex(4)).size(), 2u);
+  EXPECT_EQ(graph.getEdges().size(), 3u);
+}
+
+TEST(AdjacencyMatrixGraphTest, ReaddedVertexHasNoOldEdges) {
+  graph::AdjacencyMatrixGraph<graph::Vertex, graph::Edge> graph;
+  graph.addVertex(graph::Vertex(1));
+  graph.addVertex(graph::Vertex(2));
+  graph.addEdge(graph::Vertex(1), graph::Vertex(2));
+  graph.removeVertex(graph::Vertex(2));
+  graph.addVertex(graph::Vertex(2));
+  EXPECT_FALSE(graph.hasEdge(graph::Vertex(1), graph::Vertex(2)));
+  EXPECT_TRUE(graph.getEdges().empty());
+}
+
+TEST(AdjacencyMatrixGraphTest, RemoveVertexAcrossWordBoundary) {
+  graph::AdjacencyMatrixGraph<graph::Vertex, graph::Edge> graph;
+  for (int i = 0; i < 65; ++i) {
+    graph.addVertex(graph::Vertex(i));
+  }
+  graph.addEdge(graph::Vertex(0), graph::Vertex(64));
+  graph.addEdge(graph::Vertex(64), graph::Vertex(10));
+  EXPECT_EQ(graph.getAdjacencyRow(0).size(), 2u);
+
+  graph.removeVertex(graph::Vertex(5));
+  EXPECT_EQ(graph.getAdjacencyRow(0).size(), 1u);
+  EXPECT_TRUE(graph.hasEdge(graph::Vertex(0), graph::Vertex(64)));
+  EXPECT_TRUE(graph.hasEdge(graph::Vertex(64), graph::Vertex(10)));
+
+  graph.addVertex(graph::Vertex(100));
+  EXPECT_FALSE(graph.hasEdge(graph::Vertex(0), graph::Vertex(100)));
+  graph.addEdge(graph::Vertex(100), graph::Vertex(0));
+  EXPECT_TRUE(graph.hasEdge(graph::Vertex(100), graph::Vertex(0)));
+  EXPECT_EQ(graph.getMatrixSize(), 65u);
+}
@@ -0,0 +1,128 @@
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include "../include/graph/AdjacencyListGraph.h"
+#include "../include/graph/AdjacencyMatrixGraph.h"
+#include "../include/graph/ArenaResource.h"
+#include "../include/graph/EdgeListGraph.h"
+#include "../include/graph/UndirectedGraph.h"
+#include "gtest/gtest.h"
+
+TEST(ArenaResourceTest, AllocationsAreAligned) {
+  graph::ArenaResource arena(64);
+  for (size_t alignment : {1u, 2u, 8u, 16u, 64u}) {
+    void* pointer = arena.allocate(3, alignment);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(pointer) % alignment, 0u);
+  }
+  void* large = arena.allocate(10000, 32);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(large) % 32, 0u);
+  EXPECT_GE(arena.bytesReserved(), 10000u);
+  EXPECT_EQ(arena.bytesAllocated(), 15u + 10000u);
+}
+
+TEST(ArenaResourceTest, ReleaseAndReset) {
+  graph::ArenaResource arena(128);
+  for (int i = 0; i < 100; ++i) {
+    size_t before = arena.bytesAllocated();
+    void* pointer = arena.allocate(100, 8);
+    ASSERT_NE(pointer, nullptr);
+    EXPECT_EQ(arena.bytesAllocated(), before + 100);
+  }
+  size_t reserved = arena.bytesReserved();
+  EXPECT_GT(reserved, 0u);
+
+  arena.reset();
+  EXPECT_EQ(arena.bytesAllocated(), 0u);
+  EXPECT_LE(arena.bytesReserved(), reserved);
+  EXPECT_GT(arena.bytesReserved(), 0u);
+
+  // После сброса оставленного блока хватает без новых выделений
+  size_t afterReset = arena.bytesReserved();
+  void* pointer = arena.allocate(100, 8);
+  EXPECT_NE(pointer, nullptr);
+  EXPECT_EQ(arena.bytesAllocated(), 100u);
+  EXPECT_EQ(arena.bytesReserved(), afterReset);
+
+  arena.release();
+  EXPECT_EQ(arena.bytesReserved(), 0u);
+  EXPECT_EQ(arena.bytesAllocated(), 0u);
+}
+
+TEST(ArenaResourceTest, GraphListsConvertToStdVector) {
+  graph::ArenaResource arena;
+  graph::UndirectedGraph<graph::Vertex, graph::Edge> graph(&arena);
+  graph.addVertex(graph::Vertex(1));
+  graph.addVertex(graph::Vertex(2));
+  graph.addEdge(graph::Vertex(1), graph::Vertex(2));
+
+  std::vector<graph::Vertex> vertices = graph.getVertices();
+  std::vector<graph::Edge> edges = graph.getEdges();
+  const std::pmr::vector<graph::Vertex>& stored = graph.getVertices();
+  EXPECT_EQ(vertices.size(), 2u);
+  EXPECT_EQ(edges.size(), 2u);
+  EXPECT_EQ(stored.data(), graph.getVertices().data());
+  EXPECT_EQ(stored.get_allocator().resource(), &arena);
+}
+
+TEST(ArenaResourceTest, IsEqualOnlyToItself) {
+  graph::ArenaResource first;
+  graph::ArenaResource second;
+  EXPECT_TRUE(first.is_equal(first));
+  EXPECT_FALSE(first.is_equal(second));
+}
+
+TEST(ArenaResourceTest, AdjacencyListGraphOnArena) {
+  graph::ArenaResource arena;
+  {
+    graph::AdjacencyListGraph<graph::Vertex, graph::Edge> graph(&arena, true);
+    EXPECT_EQ(graph.getMemoryResource(), &arena);
+    for (int i = 0; i < 200; ++i) {
+      graph.addVertex(graph::Vertex(i));
+    }
+    for (int i = 0; i < 200; ++i) {
+      graph.addEdge(graph::Vertex(i), graph::Vertex((i * 7 + 3) % 200));
+      graph.addEdge(graph::Vertex(i), graph::Vertex((i + 1) % 200));
+    }
+    graph.removeVertex(graph::Vertex(5));
+    EXPECT_TRUE(graph.hasEdge(graph::Vertex(0), graph::Vertex(3)));
+    EXPECT_FALSE(graph.hasEdge(graph::Vertex(4), graph::Vertex(5)));
+    EXPECT_EQ(graph.getNeighbors(graph::Vertex(10)).size(), 2u);
+    EXPECT_GT(arena.bytesAllocated(), 200 * sizeof(graph::Vertex));
+  }
+  arena.release();
+}
+
+TEST(ArenaResourceTest, MatrixAndEdgeListGraphsOnArena) {
+  graph::ArenaResource arena;
+  graph::AdjacencyMatrixGraph<graph::Vertex, graph::Edge> matrix(&arena);
+  graph::EdgeListGraph<graph::Vertex, graph::Edge> edgeList(&arena);
+  for (int i = 1; i <= 70; ++i) {
+    matrix.addVertex(graph::Vertex(i));
+    edgeList.addVertex(graph::Vertex(i));
+  }
+  for (int i = 1; i < 70; ++i) {
+    matrix.addEdge(graph::Vertex(i), graph::Vertex(i + 1));
+    edgeList.addEdge(graph::Vertex(i), graph::Vertex(i + 1));
+  }
+  matrix.removeVertex(graph::Vertex(2));
+  EXPECT_FALSE(matrix.hasEdge(graph::Vertex(1), graph::Vertex(2)));
+  EXPECT_TRUE(matrix.hasEdge(graph::Vertex(69), graph::Vertex(70)));
+  EXPECT_EQ(matrix.getMemoryResource(), &arena);
+  EXPECT_TRUE(edgeList.hasEdge(graph::Vertex(69), graph::Vertex(70)));
+  EXPECT_EQ(edgeList.getVertices().size(), 70u);
+  EXPECT_EQ(edgeList.getMemoryResource(), &arena);
+}
+
+TEST(ArenaResourceTest, DefaultResourceWithoutArena) {
+  graph::UndirectedGraph<graph::Vertex, graph::Edge> graph;
+  EXPECT_EQ(graph.getMemoryResource(), std::pmr::get_default_resource());
+
+  graph::ArenaResource arena;
+  graph::UndirectedGraph<graph::Vertex, graph::Edge> onArena(&arena);
+  onArena.addVertex(graph::Vertex(1));
+  onArena.addVertex(graph::Vertex(2));
+  onArena.addEdge(graph::Vertex(1), graph::Vertex(2));
+  EXPECT_TRUE(onArena.hasEdge(graph::Vertex(2), graph::Vertex(1)));
+  EXPECT_EQ(onArena.getMemoryResource(), &arena);
+}
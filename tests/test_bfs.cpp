@@ -1,3 +1,7 @@
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 #include "../include/algorithms/bfs_dfs/BFS.h"
 #include "../include/graph/AdjacencyListGraph.h"
 #include "../include/graph/AdjacencyMatrixGraph.h"
@@ -6,6 +10,61 @@
 #include "../include/graph/WeightedGraph.h"
 #include "gtest/gtest.h"
 
+namespace {
+
+/**
+ * @brief Статический посетитель, запоминающий порядок обхода.
+ */
+class RecordingVisitor : public graph::NullVisitor<graph::Vertex> {
+ public:
+  std::vector<int> order;
+  std::vector<std::pair<int, int>> treeEdges;
+
+  void visitVertex(const graph::Vertex& vertex) { order.push_back(vertex.id); }
+
+  void treeEdge(const graph::Vertex& source, const graph::Vertex& target) {
+    treeEdges.emplace_back(source.id, target.id);
+  }
+};
+
+/**
+ * @brief Виртуальный посетитель, получающий рёбра через VisitorAdapter.
+ */
+class EdgeCountingVisitor
+    : public graph::Visitor<graph::Vertex, graph::Edge> {
+ public:
+  std::vector<std::pair<int, int>> examined;
+
+  void examineEdge(const graph::Edge& edge) override {
+    examined.emplace_back(edge.source.id, edge.target.id);
+  }
+};
+
+/**
+ * @brief Посетитель, останавливающий обход при достижении цели и не
+ * раскрывающий заблокированную вершину.
+ */
+class TargetVisitor : public graph::NullVisitor<graph::Vertex> {
+ public:
+  int target = -1;
+  int blocked = -1;
+  int visited = 0;
+
+  graph::VisitorAction visitVertex(const graph::Vertex& vertex) {
+    ++visited;
+    return vertex.id == blocked ? graph::VisitorAction::SkipChildren
+                                : graph::VisitorAction::Continue;
+  }
+
+  graph::VisitorAction treeEdge(const graph::Vertex&,
+                                const graph::Vertex& target) {
+    return target.id == this->target ? graph::VisitorAction::Stop
+                                     : graph::VisitorAction::Continue;
+  }
+};
+
+}  // namespace
+
 TEST(BFS_TEST, AdjacencyListThroughOne) {
   graph::AdjacencyListGraph<graph::Vertex, graph::Edge> graph;
   graph.addVertex(graph::Vertex(1));
@@ -150,3 +209,74 @@ TEST(BFS_TEST, UndirectedGraphEasy) {
   EXPECT_EQ(d[2], 1);
   EXPECT_EQ(d[3], 2);
 }
+
+TEST(BFS_TEST, StaticVisitorSeesLevelOrder) {
+  static_assert(std::is_empty_v<graph::NullVisitor<graph::Vertex>>);
+  graph::DirectedGraph<graph::Vertex, graph::Edge> graph;
+  for (int v = 1; v <= 4; ++v) {
+    graph.addVertex(graph::Vertex(v));
+  }
+  graph.addEdge(graph::Vertex(1), graph::Vertex(2));
+  graph.addEdge(graph::Vertex(2), graph::Vertex(4));
+  graph.addEdge(graph::Vertex(1), graph::Vertex(3));
+  graph.addEdge(graph::Vertex(3), graph::Vertex(4));
+  RecordingVisitor visitor;
+  auto d = graph::BFS(graph, graph::Vertex(1), visitor);
+  EXPECT_EQ(d[4], 2);
+  ASSERT_EQ(visitor.order.size(), 4u);
+  EXPECT_EQ(visitor.order.front(), 1);
+  EXPECT_EQ(visitor.order.back(), 4);
+  EXPECT_EQ(visitor.treeEdges.size(), 3u);
+
+  graph::NullVisitor<graph::Vertex> null;
+  EXPECT_EQ(graph::BFS(graph, graph::Vertex(1), null), d);
+}
+
+TEST(BFS_TEST, VirtualVisitorGoesThroughAdapter) {
+  graph::DirectedGraph<graph::Vertex, graph::Edge> graph;
+  graph.addVertex(graph::Vertex(1));
+  graph.addVertex(graph::Vertex(2));
+  graph.addEdge(graph::Vertex(1), graph::Vertex(2));
+  EdgeCountingVisitor visitor;
+  graph::Visitor<graph::Vertex, graph::Edge>& base = visitor;
+  graph::BFS(graph, graph::Vertex(1), base);
+  EXPECT_EQ(visitor.examined, (std::vector<std::pair<int, int>>{{1, 2}}));
+}
+
+TEST(BFS_TEST, VisitorStopsAtTarget) {
+  // Звезда с центром 1 и лучами 2..100
+  graph::DirectedGraph<graph::Vertex, graph::Edge> graph;
+  for (int v = 1; v <= 100; ++v) {
+    graph.addVertex(graph::Vertex(v));
+  }
+  for (int v = 2; v <= 100; ++v) {
+    graph.addEdge(graph::Vertex(1), graph::Vertex(v));
+    graph.addEdge(graph::Vertex(v), graph::Vertex(1));
+  }
+  TargetVisitor visitor;
+  visitor.target = 50;
+  auto d = graph::BFS(graph, graph::Vertex(1), visitor);
+  EXPECT_EQ(d[50], 1);
+  // Обход остановился, не раскрыв ни одного луча
+  EXPECT_EQ(visitor.visited, 1);
+}
+
+TEST(BFS_TEST, VisitorSkipsChildren) {
+  // Цепочка 1 -> 2 -> 3 -> 4 и обход 1 -> 4 в обход вершины 2
+  graph::DirectedGraph<graph::Vertex, graph::Edge> graph;
+  for (int v = 1; v <= 5; ++v) {
+    graph.addVertex(graph::Vertex(v));
+  }
+  graph.addEdge(graph::Vertex(1), graph::Vertex(2));
+  graph.addEdge(graph::Vertex(2), graph::Vertex(3));
+  graph.addEdge(graph::Vertex(3), graph::Vertex(4));
+  graph.addEdge(graph::Vertex(1), graph::Vertex(5));
+  graph.addEdge(graph::Vertex(5), graph::Vertex(4));
+  TargetVisitor visitor;
+  visitor.blocked = 2;
+  auto d = graph::BFS(graph, graph::Vertex(1), visitor);
+  EXPECT_EQ(d[2], 1);
+  EXPECT_EQ(d[3], 0);
+  EXPECT_EQ(d[4], 2);
+  EXPECT_EQ(visitor.visited, 4);
+}
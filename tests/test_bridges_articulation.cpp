@@ -1,3 +1,10 @@
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
 #include "../include/algorithms/bfs_dfs/BridgesAndArticulationPoints.h"
 #include "../include/graph/AdjacencyListGraph.h"
 #include "../include/graph/AdjacencyMatrixGraph.h"
@@ -5,8 +12,40 @@
 #include "../include/graph/EdgeListGraph.h"
 #include "../include/graph/UndirectedGraph.h"
 #include "../include/graph/WeightedGraph.h"
+#include "graph_test_utils.h"
 #include "gtest/gtest.h"
 
+namespace {
+
+using graph_test::EdgePairs;
+using graph_test::makeSymmetricView;
+using Bap = graph::BridgesAndArticulationPoints<graph::Vertex, graph::Edge>;
+
+/**
+ * @brief Число компонент связности без удалённой вершины и удалённого ребра.
+ */
+int countComponents(uint32_t n, const EdgePairs& edges, uint32_t skipVertex,
+                    size_t skipEdge) {
+  std::vector<uint32_t> parent(n);
+  for (uint32_t v = 0; v < n; ++v) parent[v] = v;
+  auto find = [&](uint32_t v) {
+    while (parent[v] != v) v = parent[v] = parent[parent[v]];
+    return v;
+  };
+  for (size_t i = 0; i < edges.size(); ++i) {
+    auto [u, v] = edges[i];
+    if (i == skipEdge || u == skipVertex || v == skipVertex) continue;
+    parent[find(u)] = find(v);
+  }
+  int count = 0;
+  for (uint32_t v = 0; v < n; ++v) {
+    if (v != skipVertex && find(v) == v) ++count;
+  }
+  return count;
+}
+
+}  // namespace
+
 TEST(BAP_TEST, AdjacencyListContains) {
   graph::AdjacencyListGraph<graph::Vertex, graph::Edge> graph;
   graph.addVertex(graph::Vertex(1));
@@ -396,3 +435,183 @@ TEST(BAP_TEST, UndirectedCycle) {
   EXPECT_EQ(std::find(points.begin(), points.end(), 2), points.end());
   EXPECT_EQ(std::find(points.begin(), points.end(), 3), points.end());
 }
+
+TEST(BAP_TEST, ArticulationPointsAreReportedOnce) {
+  // Центр звезды разделяет все лучи
+  EdgePairs edges;
+  for (uint32_t v = 1; v <= 5; ++v) {
+    edges.emplace_back(0, v);
+  }
+  edges.emplace_back(5, 6);
+  edges.emplace_back(6, 7);
+  edges.emplace_back(7, 5);
+  Bap bap(makeSymmetricView(8, edges));
+  EXPECT_EQ(bap.findArticulationPoints(), (std::vector<int>{0, 5}));
+  EXPECT_EQ(bap.findBridges().size(), 5u);
+}
+
+TEST(BAP_TEST, ParallelEdgeIsNotBridge) {
+  Bap bap(makeSymmetricView(3, {{0, 1}, {0, 1}, {1, 2}}));
+  auto bridges = bap.findBridges();
+  ASSERT_EQ(bridges.size(), 1u);
+  EXPECT_EQ(bridges[0], graph::Edge(graph::Vertex(1), graph::Vertex(2)));
+  EXPECT_EQ(bap.findArticulationPoints(), (std::vector<int>{1}));
+}
+
+TEST(BAP_TEST, RandomGraphsMatchBruteForce) {
+  std::mt19937 rng(46);
+  for (int trial = 0; trial < 150; ++trial) {
+    uint32_t n = 1 + static_cast<uint32_t>(rng() % 25);
+    EdgePairs edges;
+    for (uint32_t i = 0, m = static_cast<uint32_t>(rng() % (2 * n)); i < m;
+         ++i) {
+      uint32_t u = static_cast<uint32_t>(rng() % n);
+      uint32_t v = static_cast<uint32_t>(rng() % n);
+      if (u != v) edges.emplace_back(u, v);
+    }
+    Bap bap(makeSymmetricView(n, edges));
+    const int base = countComponents(n, edges, UINT32_MAX, SIZE_MAX);
+
+    std::set<std::pair<int, int>> expectedBridges;
+    for (size_t i = 0; i < edges.size(); ++i) {
+      if (countComponents(n, edges, UINT32_MAX, i) > base) {
+        auto [u, v] = edges[i];
+        expectedBridges.emplace(std::min(u, v), std::max(u, v));
+      }
+    }
+    std::set<std::pair<int, int>> bridges;
+    for (const auto& e : bap.findBridges()) {
+      ASSERT_TRUE(bridges
+                      .emplace(std::min(e.source.id, e.target.id),
+                               std::max(e.source.id, e.target.id))
+                      .second);
+    }
+    ASSERT_EQ(bridges, expectedBridges);
+
+    std::vector<int> expectedPoints;
+    for (uint32_t v = 0; v < n; ++v) {
+      bool isolated = std::none_of(edges.begin(), edges.end(), [&](auto e) {
+        return e.first == v || e.second == v;
+      });
+      if (!isolated &&
+          countComponents(n, edges, v, SIZE_MAX) > base) {
+        expectedPoints.push_back(static_cast<int>(v));
+      }
+    }
+    ASSERT_EQ(bap.findArticulationPoints(), expectedPoints);
+  }
+}
+
+TEST(BAP_TEST, MillionVertexPath) {
+  const uint32_t n = 1000000;
+  EdgePairs edges;
+  for (uint32_t v = 0; v + 1 < n; ++v) {
+    edges.emplace_back(v, v + 1);
+  }
+  Bap bap(makeSymmetricView(n, edges));
+  EXPECT_EQ(bap.findBridges().size(), n - 1);
+  EXPECT_EQ(bap.findArticulationPoints().size(), n - 2);
+}
+
+TEST(BAP_TEST, BlocksAndBlockCutTree) {
+  // Мост 0-1, цикл 1-2-3-4 и висячее ребро 2-5
+  Bap bap(makeSymmetricView(
+      6, {{0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 1}, {2, 5}}));
+  ASSERT_EQ(bap.blockCount(), 3u);
+
+  const auto& view = bap.getView();
+  std::set<uint32_t> cycleBlocks;
+  for (size_t u = 0; u < view.vertexCount(); ++u) {
+    for (size_t i = view.begin(u); i < view.end(u); ++i) {
+      uint32_t w = view.neighbor(i);
+      if (u != 0 && w != 0 && u != 5 && w != 5) {
+        cycleBlocks.insert(bap.getEdgeBlock(i));
+      }
+    }
+  }
+  ASSERT_EQ(cycleBlocks.size(), 1u);
+  auto cycle = bap.getBlockVertices(*cycleBlocks.begin());
+  std::sort(cycle.begin(), cycle.end(),
+            [](const auto& a, const auto& b) { return a.id < b.id; });
+  EXPECT_EQ(cycle, (std::vector<graph::Vertex>{
+                       graph::Vertex(1), graph::Vertex(2), graph::Vertex(3),
+                       graph::Vertex(4)}));
+
+  // Три блока и точки сочленения 1 и 2: путь блок-1-цикл-2-блок
+  auto tree = bap.getBlockCutTree();
+  ASSERT_EQ(tree.vertexCount(), 5u);
+  EXPECT_EQ(tree.edgeCount(), 8u);
+  EXPECT_EQ(tree.degree(*cycleBlocks.begin()), 2u);
+  EXPECT_EQ(tree.degree(3), 2u);
+  EXPECT_EQ(tree.degree(4), 2u);
+}
+
+TEST(BAP_TEST, RandomBlocksAreMaximalBiconnected) {
+  std::mt19937 rng(47);
+  for (int trial = 0; trial < 150; ++trial) {
+    uint32_t n = 1 + static_cast<uint32_t>(rng() % 20);
+    EdgePairs edges;
+    for (uint32_t i = 0, m = static_cast<uint32_t>(rng() % (2 * n)); i < m;
+         ++i) {
+      uint32_t u = static_cast<uint32_t>(rng() % n);
+      uint32_t v = static_cast<uint32_t>(rng() % n);
+      edges.emplace_back(u, v);
+    }
+    Bap bap(makeSymmetricView(n, edges));
+    const auto& view = bap.getView();
+    const size_t blocks = bap.blockCount();
+
+    // Оба направления ребра в одном блоке, петли вне блоков
+    std::vector<EdgePairs> blockEdges(blocks);
+    std::vector<std::set<uint32_t>> blockVertices(blocks);
+    for (uint32_t u = 0; u < n; ++u) {
+      for (size_t i = view.begin(u); i < view.end(u); ++i) {
+        uint32_t w = view.neighbor(i);
+        uint32_t b = bap.getEdgeBlock(i);
+        if (u == w) {
+          ASSERT_EQ(b, Bap::kNone);
+          continue;
+        }
+        ASSERT_LT(b, blocks);
+        blockVertices[b].insert(u);
+        if (u < w) blockEdges[b].emplace_back(u, w);
+      }
+    }
+    for (size_t b = 0; b < blocks; ++b) {
+      std::set<uint32_t> members;
+      for (const auto& v : bap.getBlockVertices(b)) members.insert(v.id);
+      ASSERT_EQ(members, blockVertices[b]);
+      // Блок связен и не распадается при удалении любой вершины
+      const auto& local = blockEdges[b];
+      const int outside = static_cast<int>(n - members.size());
+      ASSERT_EQ(countComponents(n, local, UINT32_MAX, SIZE_MAX), outside + 1);
+      if (members.size() > 2) {
+        for (uint32_t v : members) {
+          ASSERT_EQ(countComponents(n, local, v, SIZE_MAX), outside + 1);
+        }
+      }
+    }
+
+    // Граф инцидентности блоков и вершин — лес, значит блоки максимальны
+    size_t incidences = 0;
+    std::set<uint32_t> covered;
+    for (const auto& members : blockVertices) {
+      incidences += members.size();
+      covered.insert(members.begin(), members.end());
+    }
+    EdgePairs proper;
+    for (const auto& [u, v] : edges) {
+      if (u != v) proper.emplace_back(u, v);
+    }
+    size_t isolated = n - covered.size();
+    size_t components =
+        countComponents(n, proper, UINT32_MAX, SIZE_MAX) - isolated;
+    ASSERT_EQ(incidences, blocks + covered.size() - components);
+
+    // Дерево блоков: по ребру на каждую пару (блок, точка сочленения)
+    auto tree = bap.getBlockCutTree();
+    size_t points = bap.findArticulationPoints().size();
+    ASSERT_EQ(tree.vertexCount(), blocks + points);
+    ASSERT_EQ(tree.edgeCount(), 2 * (blocks + points - components));
+  }
+}
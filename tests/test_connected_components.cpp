@@ -0,0 +1,100 @@
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../include/algorithms/bfs_dfs/ConnectedComponents.h"
+#include "../include/graph/AdjacencyListGraph.h"
+#include "../include/graph/UndirectedGraph.h"
+#include "graph_test_utils.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using graph_test::EdgePairs;
+using graph_test::makeView;
+
+/**
+ * @brief Номера компонент обходом в ширину по неориентированным рёбрам.
+ */
+std::vector<uint32_t> bfsLabels(uint32_t n, const EdgePairs& edges) {
+  std::vector<std::vector<uint32_t>> adjacency(n);
+  for (const auto& [u, v] : edges) {
+    adjacency[u].push_back(v);
+    adjacency[v].push_back(u);
+  }
+  std::vector<uint32_t> labels(n, UINT32_MAX);
+  uint32_t next = 0;
+  for (uint32_t s = 0; s < n; ++s) {
+    if (labels[s] != UINT32_MAX) continue;
+    std::vector<uint32_t> queue{s};
+    labels[s] = next;
+    for (size_t i = 0; i < queue.size(); ++i) {
+      for (uint32_t w : adjacency[queue[i]]) {
+        if (labels[w] == UINT32_MAX) {
+          labels[w] = next;
+          queue.push_back(w);
+        }
+      }
+    }
+    ++next;
+  }
+  return labels;
+}
+
+}  // namespace
+
+TEST(ConnectedComponentsTest, UndirectedGraph) {
+  graph::UndirectedGraph<> graph;
+  for (int v = 1; v <= 6; ++v) {
+    graph.addVertex(graph::Vertex(v));
+  }
+  graph.addEdge(graph::Vertex(1), graph::Vertex(2));
+  graph.addEdge(graph::Vertex(3), graph::Vertex(2));
+  graph.addEdge(graph::Vertex(4), graph::Vertex(5));
+
+  graph::AdjacencyView<> view(graph);
+  graph::ConnectedComponents<> cc(view);
+  EXPECT_EQ(cc.componentCount(), 3u);
+  size_t v1 = view.getIndex(graph::Vertex(1));
+  EXPECT_EQ(cc.getComponent(v1), cc.getComponent(view.getIndex(
+                                      graph::Vertex(3))));
+  EXPECT_NE(cc.getComponent(v1), cc.getComponent(view.getIndex(
+                                      graph::Vertex(4))));
+  EXPECT_NE(cc.getComponent(view.getIndex(graph::Vertex(6))),
+            cc.getComponent(view.getIndex(graph::Vertex(5))));
+}
+
+TEST(ConnectedComponentsTest, OneWayEdgesAreUndirected) {
+  graph::AdjacencyListGraph<> graph;
+  for (int v = 1; v <= 4; ++v) {
+    graph.addVertex(graph::Vertex(v));
+  }
+  graph.addEdge(graph::Vertex(2), graph::Vertex(1));
+  graph.addEdge(graph::Vertex(3), graph::Vertex(4));
+
+  graph::AdjacencyView<> view(graph);
+  graph::ConnectedComponents<> cc(view);
+  EXPECT_EQ(cc.componentCount(), 2u);
+  EXPECT_EQ(cc.getComponent(view.getIndex(graph::Vertex(1))),
+            cc.getComponent(view.getIndex(graph::Vertex(2))));
+}
+
+TEST(ConnectedComponentsTest, RandomGraphsMatchBfs) {
+  std::mt19937 rng(48);
+  for (int trial = 0; trial < 100; ++trial) {
+    uint32_t n = 1 + static_cast<uint32_t>(rng() % 200);
+    EdgePairs edges;
+    for (uint32_t i = 0, m = static_cast<uint32_t>(rng() % n); i < m; ++i) {
+      edges.emplace_back(static_cast<uint32_t>(rng() % n),
+                         static_cast<uint32_t>(rng() % n));
+    }
+    graph::ConnectedComponents<> cc(makeView(n, edges));
+    auto expected = bfsLabels(n, edges);
+    ASSERT_EQ(cc.getComponents(), expected);
+    ASSERT_EQ(cc.componentCount(),
+              n == 0 ? 0 : *std::max_element(expected.begin(),
+                                             expected.end()) + 1);
+  }
+}
@@ -0,0 +1,169 @@
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../include/algorithms/find_distance/BellmanFord.h"
+#include "../include/algorithms/find_distance/DagPaths.h"
+#include "../include/graph/WeightedGraph.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using EdgePairs = std::vector<std::pair<uint32_t, uint32_t>>;
+
+/**
+ * @brief Граф задач: 0 -> {1, 2}, 1 -> 3, 2 -> 3, 3 -> 4.
+ */
+graph::WeightedGraph<> makePipeline() {
+  graph::WeightedGraph<> graph;
+  for (int v = 0; v <= 4; ++v) {
+    graph.addVertex(graph::Vertex(v));
+  }
+  graph.addEdge(graph::Vertex(0), graph::Vertex(1), 3);
+  graph.addEdge(graph::Vertex(0), graph::Vertex(2), 1);
+  graph.addEdge(graph::Vertex(1), graph::Vertex(3), 2);
+  graph.addEdge(graph::Vertex(2), graph::Vertex(3), 7);
+  graph.addEdge(graph::Vertex(3), graph::Vertex(4), -1);
+  return graph;
+}
+
+}  // namespace
+
+TEST(DagPathsTest, ShortestMatchesBellmanFord) {
+  auto graph = makePipeline();
+  graph::DagPaths<> paths(graph);
+  paths.solve(graph::Vertex(0));
+  auto expected = graph::BellmanFord(graph, graph::Vertex(0));
+  for (const auto& v : graph.getVertices()) {
+    EXPECT_EQ(paths.getDistance(v), expected[v]);
+  }
+  EXPECT_EQ(paths.getPath(graph::Vertex(4)),
+            (std::vector<graph::Vertex>{graph::Vertex(0), graph::Vertex(1),
+                                        graph::Vertex(3), graph::Vertex(4)}));
+
+  paths.solve(graph::Vertex(2));
+  EXPECT_FALSE(paths.isReachable(graph::Vertex(1)));
+  EXPECT_EQ(paths.getDistance(graph::Vertex(1)),
+            std::numeric_limits<int>::max());
+  EXPECT_TRUE(paths.getPath(graph::Vertex(1)).empty());
+  EXPECT_THROW(paths.solve(graph::Vertex(9)), std::out_of_range);
+}
+
+TEST(DagPathsTest, LongestAndCriticalPath) {
+  auto graph = makePipeline();
+  graph::DagPaths<> paths(graph, graph::DagPathKind::Longest);
+  paths.solve(graph::Vertex(0));
+  EXPECT_EQ(paths.getDistance(graph::Vertex(3)), 8);
+  EXPECT_EQ(paths.getDistance(graph::Vertex(4)), 7);
+
+  auto [length, path] = graph::criticalPath(graph);
+  EXPECT_EQ(length, 8);
+  EXPECT_EQ(path, (std::vector<graph::Vertex>{
+                      graph::Vertex(0), graph::Vertex(2), graph::Vertex(3)}));
+}
+
+TEST(DagPathsTest, UnsolvedQueriesReportUnreachable) {
+  auto graph = makePipeline();
+  graph::DagPaths<> paths(graph, graph::DagPathKind::Longest);
+  EXPECT_FALSE(paths.isReachable(graph::Vertex(0)));
+  EXPECT_EQ(paths.getDistance(graph::Vertex(4)),
+            std::numeric_limits<int>::lowest());
+  EXPECT_EQ(paths.getDistances().size(), 5u);
+  EXPECT_TRUE(paths.getPath(graph::Vertex(4)).empty());
+}
+
+TEST(DagPathsTest, RejectsCycles) {
+  auto graph = makePipeline();
+  graph.addEdge(graph::Vertex(4), graph::Vertex(0), 1);
+  EXPECT_THROW(graph::DagPaths<>{graph}, std::invalid_argument);
+  EXPECT_THROW(graph::criticalPath(graph), std::invalid_argument);
+}
+
+TEST(DagPathsTest, RandomDagsMatchDynamicProgramming) {
+  std::mt19937 rng(50);
+  for (int trial = 0; trial < 50; ++trial) {
+    const uint32_t n = 2 + static_cast<uint32_t>(rng() % 80);
+    // Рёбра от меньшего индекса к большему: индексы — топологический порядок
+    std::vector<std::vector<std::pair<uint32_t, long long>>> in(n);
+    EdgePairs edges;
+    std::vector<long long> weights;
+    for (uint32_t i = 0; i < 3 * n; ++i) {
+      uint32_t a = static_cast<uint32_t>(rng() % n);
+      uint32_t b = static_cast<uint32_t>(rng() % n);
+      if (a == b) continue;
+      if (a > b) std::swap(a, b);
+      long long w = static_cast<long long>(rng() % 21) - 5;
+      edges.emplace_back(a, b);
+      weights.push_back(w);
+      in[b].emplace_back(a, w);
+    }
+    std::vector<graph::Vertex> vertices;
+    for (uint32_t v = 0; v < n; ++v) {
+      vertices.emplace_back(static_cast<int>(n - 1 - v));
+    }
+    graph::AdjacencyView<> view(vertices, edges);
+    // Веса по позициям: рёбра одной вершины лежат в порядке добавления
+    std::vector<long long> byPosition(view.edgeCount());
+    std::vector<size_t> cursor(n);
+    for (uint32_t u = 0; u < n; ++u) cursor[u] = view.begin(u);
+    for (size_t i = 0; i < edges.size(); ++i) {
+      byPosition[cursor[edges[i].first]++] = weights[i];
+    }
+
+    for (auto kind : {graph::DagPathKind::Shortest,
+                      graph::DagPathKind::Longest}) {
+      const bool shortest = kind == graph::DagPathKind::Shortest;
+      std::vector<long long> expected(n);
+      std::vector<char> reached(n, 0);
+      reached[0] = 1;
+      for (uint32_t v = 1; v < n; ++v) {
+        for (const auto& [u, w] : in[v]) {
+          if (!reached[u]) continue;
+          long long candidate = expected[u] + w;
+          if (!reached[v] || (shortest ? candidate < expected[v]
+                                       : candidate > expected[v])) {
+            expected[v] = candidate;
+          }
+          reached[v] = 1;
+        }
+      }
+
+      graph::DagPaths<graph::Vertex, long long> paths(view, byPosition, kind);
+      paths.solve(vertices[0]);
+      for (uint32_t v = 0; v < n; ++v) {
+        ASSERT_EQ(paths.isReachable(vertices[v]), reached[v] != 0);
+        if (reached[v]) {
+          ASSERT_EQ(paths.getDistance(vertices[v]), expected[v]);
+        }
+      }
+    }
+  }
+}
+
+TEST(DagPathsTest, TwoMillionTaskChain) {
+  const uint32_t n = 2000000;
+  std::vector<graph::Vertex> vertices;
+  vertices.reserve(n);
+  EdgePairs edges;
+  std::vector<long long> weights;
+  for (uint32_t v = 0; v < n; ++v) {
+    vertices.emplace_back(static_cast<int>(v));
+    if (v + 1 < n) {
+      edges.emplace_back(v, v + 1);
+      weights.push_back(1);
+    }
+    if (v + 2 < n && v % 2 == 0) {
+      edges.emplace_back(v, v + 2);
+      weights.push_back(3);
+    }
+  }
+  graph::AdjacencyView<> view(std::move(vertices), edges);
+  graph::DagPaths<graph::Vertex, long long> paths(
+      std::move(view), std::move(weights), graph::DagPathKind::Longest);
+  paths.solveFromAll();
+  // Из чётной вершины прыжок на две дороже двух шагов по одному
+  EXPECT_EQ(paths.getDistances().back(), 3LL * (n / 2 - 1) + 1);
+}
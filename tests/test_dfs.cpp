@@ -1,3 +1,10 @@
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <utility>
+#include <vector>
+
 #include "../include/algorithms/bfs_dfs/DFS.h"
 #include "../include/graph/AdjacencyListGraph.h"
 #include "../include/graph/AdjacencyMatrixGraph.h"
@@ -7,6 +14,116 @@
 #include "../include/graph/WeightedGraph.h"
 #include "gtest/gtest.h"
 
+namespace {
+
+bool contains(const std::vector<graph::Vertex>& vertices, int id) {
+  return std::find(vertices.begin(), vertices.end(), graph::Vertex(id)) !=
+         vertices.end();
+}
+
+/**
+ * @brief Статический посетитель, запоминающий рёбра дерева обхода.
+ */
+class TreeEdgeVisitor : public graph::NullVisitor<graph::Vertex> {
+ public:
+  std::vector<std::pair<int, int>> treeEdges;
+
+  void treeEdge(const graph::Vertex& source, const graph::Vertex& target) {
+    treeEdges.emplace_back(source.id, target.id);
+  }
+};
+
+/**
+ * @brief Посетитель, останавливающий обход при исследовании ребра в цель.
+ */
+class StopVisitor : public graph::NullVisitor<graph::Vertex> {
+ public:
+  int target = -1;
+  int examined = 0;
+
+  graph::VisitorAction examineEdge(const graph::Vertex&,
+                                   const graph::Vertex& target) {
+    ++examined;
+    return target.id == this->target ? graph::VisitorAction::Stop
+                                     : graph::VisitorAction::Continue;
+  }
+};
+
+/**
+ * @brief Посетитель, раскладывающий рёбра по типам.
+ */
+class ClassifyingVisitor : public graph::NullVisitor<graph::Vertex> {
+ public:
+  using Edges = std::vector<std::pair<int, int>>;
+  Edges tree, back, forward, cross;
+
+  void treeEdge(const graph::Vertex& source, const graph::Vertex& target) {
+    tree.emplace_back(source.id, target.id);
+  }
+  void backEdge(const graph::Vertex& source, const graph::Vertex& target) {
+    back.emplace_back(source.id, target.id);
+  }
+  void forwardEdge(const graph::Vertex& source, const graph::Vertex& target) {
+    forward.emplace_back(source.id, target.id);
+  }
+  void crossEdge(const graph::Vertex& source, const graph::Vertex& target) {
+    cross.emplace_back(source.id, target.id);
+  }
+};
+
+/**
+ * @brief Посетитель по индексам, считающий рёбра каждого типа.
+ */
+struct EdgeKindCounter : graph::NullVisitor<size_t> {
+  size_t counts[4] = {0, 0, 0, 0};
+
+  void treeEdge(size_t, size_t) { ++counts[0]; }
+  void backEdge(size_t, size_t) { ++counts[1]; }
+  void forwardEdge(size_t, size_t) { ++counts[2]; }
+  void crossEdge(size_t, size_t) { ++counts[3]; }
+};
+
+/**
+ * @brief Рекурсивный поиск в глубину для сверки с итеративным.
+ */
+struct RecursiveDfs {
+  const graph::AdjacencyView<>& view;
+  std::vector<uint32_t> discover, finish;
+  std::vector<char> onStack;
+  size_t counts[4] = {0, 0, 0, 0};
+  uint32_t time = 0;
+
+  explicit RecursiveDfs(const graph::AdjacencyView<>& view)
+      : view(view),
+        discover(view.vertexCount(), UINT32_MAX),
+        finish(view.vertexCount(), UINT32_MAX),
+        onStack(view.vertexCount(), 0) {
+    for (size_t v = 0; v < view.vertexCount(); ++v) {
+      if (discover[v] == UINT32_MAX) visit(v);
+    }
+  }
+
+  void visit(size_t u) {
+    discover[u] = time++;
+    onStack[u] = 1;
+    for (size_t i = view.begin(u); i < view.end(u); ++i) {
+      size_t v = view.neighbor(i);
+      if (discover[v] == UINT32_MAX) {
+        ++counts[0];
+        visit(v);
+      } else if (onStack[v]) {
+        ++counts[1];
+      } else {
+        ++counts[discover[u] < discover[v] ? 2 : 3];
+      }
+    }
+    onStack[u] = 0;
+    finish[u] = time++;
+  }
+};
+
+}  // namespace
+
 TEST(DFS_TEST, AdjacencyListNoVertex) {
   graph::AdjacencyListGraph<graph::Vertex, graph::Edge> graph;
   graph.addVertex(graph::Vertex(1));
@@ -18,8 +135,8 @@ TEST(DFS_TEST, AdjacencyListNoVertex) {
   graph.addEdge(graph::Vertex(1), graph::Vertex(3));
   graph::DefaultVisitor<graph::Vertex, graph::Edge> visitor;
   auto d = graph::DFS(graph, graph::Vertex(1), visitor);
-  EXPECT_EQ(d.find(graph::Vertex(4)), d.end());
-  EXPECT_NE(d.find(graph::Vertex(1)), d.end());
+  EXPECT_FALSE(contains(d, 4));
+  EXPECT_TRUE(contains(d, 1));
 }
 
 TEST(DFS_TEST, AdjacencyListNoMultipleVertex) {
@@ -35,9 +152,9 @@ TEST(DFS_TEST, AdjacencyListNoMultipleVertex) {
   graph.addEdge(graph::Vertex(4), graph::Vertex(5));
   graph::DefaultVisitor<graph::Vertex, graph::Edge> visitor;
   auto d = graph::DFS(graph, graph::Vertex(1), visitor);
-  EXPECT_EQ(d.find(graph::Vertex(4)), d.end());
-  EXPECT_NE(d.find(graph::Vertex(1)), d.end());
-  EXPECT_EQ(d.find(graph::Vertex(5)), d.end());
+  EXPECT_FALSE(contains(d, 4));
+  EXPECT_TRUE(contains(d, 1));
+  EXPECT_FALSE(contains(d, 5));
 }
 
 TEST(DFS_TEST, AdjacencyMatrixNoVertex) {
@@ -51,8 +168,8 @@ TEST(DFS_TEST, AdjacencyMatrixNoVertex) {
   graph.addEdge(graph::Vertex(1), graph::Vertex(3));
   graph::DefaultVisitor<graph::Vertex, graph::Edge> visitor;
   auto d = graph::DFS(graph, graph::Vertex(1), visitor);
-  EXPECT_EQ(d.find(graph::Vertex(4)), d.end());
-  EXPECT_NE(d.find(graph::Vertex(1)), d.end());
+  EXPECT_FALSE(contains(d, 4));
+  EXPECT_TRUE(contains(d, 1));
 }
 
 TEST(DFS_TEST, AdjacencyMatrixNoMultipleVertex) {
@@ -68,9 +185,22 @@ TEST(DFS_TEST, AdjacencyMatrixNoMultipleVertex) {
   graph.addEdge(graph::Vertex(4), graph::Vertex(5));
   graph::DefaultVisitor<graph::Vertex, graph::Edge> visitor;
   auto d = graph::DFS(graph, graph::Vertex(1), visitor);
-  EXPECT_EQ(d.find(graph::Vertex(4)), d.end());
-  EXPECT_NE(d.find(graph::Vertex(1)), d.end());
-  EXPECT_EQ(d.find(graph::Vertex(5)), d.end());
+  EXPECT_FALSE(contains(d, 4));
+  EXPECT_TRUE(contains(d, 1));
+  EXPECT_FALSE(contains(d, 5));
+}
+
+TEST(DFS_TEST, AdjacencyMatrixRemovedVertexLosesEdges) {
+  graph::AdjacencyMatrixGraph<graph::Vertex, graph::Edge> graph;
+  graph.addVertex(graph::Vertex(1));
+  graph.addVertex(graph::Vertex(2));
+  graph.addEdge(graph::Vertex(1), graph::Vertex(2));
+  graph.removeVertex(graph::Vertex(2));
+  graph.addVertex(graph::Vertex(2));
+  graph::DefaultVisitor<graph::Vertex, graph::Edge> visitor;
+  auto d = graph::DFS(graph, graph::Vertex(1), visitor);
+  EXPECT_TRUE(contains(d, 1));
+  EXPECT_FALSE(contains(d, 2));
 }
 
 TEST(DFS_TEST, DirectedNoVertex) {
@@ -84,8 +214,8 @@ TEST(DFS_TEST, DirectedNoVertex) {
   graph.addEdge(graph::Vertex(1), graph::Vertex(3));
   graph::DefaultVisitor<graph::Vertex, graph::Edge> visitor;
   auto d = graph::DFS(graph, graph::Vertex(1), visitor);
-  EXPECT_EQ(d.find(graph::Vertex(4)), d.end());
-  EXPECT_NE(d.find(graph::Vertex(1)), d.end());
+  EXPECT_FALSE(contains(d, 4));
+  EXPECT_TRUE(contains(d, 1));
 }
 
 TEST(DFS_TEST, DirectedNoMultipleVertex) {
@@ -101,9 +231,9 @@ TEST(DFS_TEST, DirectedNoMultipleVertex) {
   graph.addEdge(graph::Vertex(4), graph::Vertex(5));
   graph::DefaultVisitor<graph::Vertex, graph::Edge> visitor;
   auto d = graph::DFS(graph, graph::Vertex(1), visitor);
-  EXPECT_EQ(d.find(graph::Vertex(4)), d.end());
-  EXPECT_NE(d.find(graph::Vertex(1)), d.end());
-  EXPECT_EQ(d.find(graph::Vertex(5)), d.end());
+  EXPECT_FALSE(contains(d, 4));
+  EXPECT_TRUE(contains(d, 1));
+  EXPECT_FALSE(contains(d, 5));
 }
 
 TEST(DFS_TEST, EdgeListNoVertex) {
@@ -117,8 +247,8 @@ TEST(DFS_TEST, EdgeListNoVertex) {
   graph.addEdge(graph::Vertex(1), graph::Vertex(3));
   graph::DefaultVisitor<graph::Vertex, graph::Edge> visitor;
   auto d = graph::DFS(graph, graph::Vertex(1), visitor);
-  EXPECT_EQ(d.find(graph::Vertex(4)), d.end());
-  EXPECT_NE(d.find(graph::Vertex(1)), d.end());
+  EXPECT_FALSE(contains(d, 4));
+  EXPECT_TRUE(contains(d, 1));
 }
 
 TEST(DFS_TEST, EdgeListNoMultipleVertex) {
@@ -134,9 +264,9 @@ TEST(DFS_TEST, EdgeListNoMultipleVertex) {
   graph.addEdge(graph::Vertex(4), graph::Vertex(5));
   graph::DefaultVisitor<graph::Vertex, graph::Edge> visitor;
   auto d = graph::DFS(graph, graph::Vertex(1), visitor);
-  EXPECT_EQ(d.find(graph::Vertex(4)), d.end());
-  EXPECT_NE(d.find(graph::Vertex(1)), d.end());
-  EXPECT_EQ(d.find(graph::Vertex(5)), d.end());
+  EXPECT_FALSE(contains(d, 4));
+  EXPECT_TRUE(contains(d, 1));
+  EXPECT_FALSE(contains(d, 5));
 }
 
 TEST(DFS_TEST, UndirectedNoVertex) {
@@ -150,8 +280,8 @@ TEST(DFS_TEST, UndirectedNoVertex) {
   graph.addEdge(graph::Vertex(1), graph::Vertex(3));
   graph::DefaultVisitor<graph::Vertex, graph::Edge> visitor;
   auto d = graph::DFS(graph, graph::Vertex(1), visitor);
-  EXPECT_EQ(d.find(graph::Vertex(4)), d.end());
-  EXPECT_NE(d.find(graph::Vertex(1)), d.end());
+  EXPECT_FALSE(contains(d, 4));
+  EXPECT_TRUE(contains(d, 1));
 }
 
 TEST(DFS_TEST, UndirectedNoMultipleVertex) {
@@ -167,7 +297,114 @@ TEST(DFS_TEST, UndirectedNoMultipleVertex) {
   graph.addEdge(graph::Vertex(4), graph::Vertex(5));
   graph::DefaultVisitor<graph::Vertex, graph::Edge> visitor;
   auto d = graph::DFS(graph, graph::Vertex(1), visitor);
-  EXPECT_EQ(d.find(graph::Vertex(4)), d.end());
-  EXPECT_NE(d.find(graph::Vertex(1)), d.end());
-  EXPECT_EQ(d.find(graph::Vertex(5)), d.end());
+  EXPECT_FALSE(contains(d, 4));
+  EXPECT_TRUE(contains(d, 1));
+  EXPECT_FALSE(contains(d, 5));
+}
+
+TEST(DFS_TEST, StaticVisitorSeesTreeEdges) {
+  graph::UndirectedGraph<graph::Vertex, graph::Edge> graph;
+  for (int v = 1; v <= 4; ++v) {
+    graph.addVertex(graph::Vertex(v));
+  }
+  graph.addEdge(graph::Vertex(1), graph::Vertex(2));
+  graph.addEdge(graph::Vertex(2), graph::Vertex(3));
+  graph.addEdge(graph::Vertex(3), graph::Vertex(1));
+  TreeEdgeVisitor visitor;
+  auto visited = graph::DFS(graph, graph::Vertex(1), visitor);
+  EXPECT_EQ(visited.size(), 3u);
+  EXPECT_FALSE(contains(visited, 4));
+  // Дерево обхода связывает все достигнутые вершины
+  ASSERT_EQ(visitor.treeEdges.size(), 2u);
+  for (const auto& [source, target] : visitor.treeEdges) {
+    EXPECT_TRUE(graph.hasEdge(graph::Vertex(source), graph::Vertex(target)));
+  }
+}
+
+TEST(DFS_TEST, VisitorStopsAtTarget) {
+  // Цепочка 1 -> 2 -> ... -> 50
+  graph::DirectedGraph<graph::Vertex, graph::Edge> graph;
+  for (int v = 1; v <= 50; ++v) {
+    graph.addVertex(graph::Vertex(v));
+  }
+  for (int v = 1; v < 50; ++v) {
+    graph.addEdge(graph::Vertex(v), graph::Vertex(v + 1));
+  }
+  StopVisitor visitor;
+  visitor.target = 10;
+  auto visited = graph::DFS(graph, graph::Vertex(1), visitor);
+  EXPECT_EQ(visitor.examined, 9);
+  EXPECT_EQ(visited.size(), 9u);
+  EXPECT_FALSE(contains(visited, 10));
+}
+
+TEST(DFS_TEST, TrueDepthFirstOrderAndEdgeKinds) {
+  graph::DirectedGraph<graph::Vertex, graph::Edge> graph;
+  for (int v = 1; v <= 4; ++v) {
+    graph.addVertex(graph::Vertex(v));
+  }
+  graph.addEdge(graph::Vertex(1), graph::Vertex(2));
+  graph.addEdge(graph::Vertex(2), graph::Vertex(4));
+  graph.addEdge(graph::Vertex(4), graph::Vertex(1));
+  graph.addEdge(graph::Vertex(1), graph::Vertex(4));
+  graph.addEdge(graph::Vertex(1), graph::Vertex(3));
+  graph.addEdge(graph::Vertex(3), graph::Vertex(4));
+  ClassifyingVisitor visitor;
+  auto order = graph::DFS(graph, graph::Vertex(1), visitor);
+  ASSERT_EQ(order.size(), 4u);
+  EXPECT_EQ(order[0].id, 1);
+  EXPECT_EQ(order[1].id, 2);
+  EXPECT_EQ(order[2].id, 4);
+  EXPECT_EQ(order[3].id, 3);
+  EXPECT_EQ(visitor.tree, (ClassifyingVisitor::Edges{{1, 2}, {2, 4}, {1, 3}}));
+  EXPECT_EQ(visitor.back, (ClassifyingVisitor::Edges{{4, 1}}));
+  EXPECT_EQ(visitor.forward, (ClassifyingVisitor::Edges{{1, 4}}));
+  EXPECT_EQ(visitor.cross, (ClassifyingVisitor::Edges{{3, 4}}));
+}
+
+TEST(DFS_TEST, RandomGraphsMatchRecursiveDfs) {
+  std::mt19937 rng(43);
+  for (int trial = 0; trial < 100; ++trial) {
+    uint32_t n = 1 + static_cast<uint32_t>(rng() % 40);
+    std::vector<graph::Vertex> vertices;
+    for (uint32_t v = 0; v < n; ++v) {
+      vertices.emplace_back(static_cast<int>(v));
+    }
+    std::vector<std::pair<uint32_t, uint32_t>> edges;
+    for (uint32_t i = 0, m = static_cast<uint32_t>(rng() % (3 * n)); i < m;
+         ++i) {
+      edges.emplace_back(static_cast<uint32_t>(rng() % n),
+                         static_cast<uint32_t>(rng() % n));
+    }
+    graph::AdjacencyView<> view(vertices, edges);
+    RecursiveDfs reference(view);
+
+    graph::DepthFirstSearch<> search(view);
+    EdgeKindCounter counter;
+    ASSERT_TRUE(search.visitAll(counter));
+    for (uint32_t v = 0; v < n; ++v) {
+      ASSERT_EQ(search.getDiscoverTime(v), reference.discover[v]);
+      ASSERT_EQ(search.getFinishTime(v), reference.finish[v]);
+    }
+    for (int kind = 0; kind < 4; ++kind) {
+      ASSERT_EQ(counter.counts[kind], reference.counts[kind]);
+    }
+  }
+}
+
+TEST(DFS_TEST, MillionDeepChain) {
+  const uint32_t n = 1000000;
+  std::vector<graph::Vertex> vertices;
+  std::vector<std::pair<uint32_t, uint32_t>> edges;
+  for (uint32_t v = 0; v < n; ++v) {
+    vertices.emplace_back(static_cast<int>(v));
+    if (v + 1 < n) edges.emplace_back(v, v + 1);
+  }
+  graph::AdjacencyView<> view(std::move(vertices), edges);
+  graph::DepthFirstSearch<> search(view);
+  graph::NullVisitor<size_t> visitor;
+  ASSERT_TRUE(search.visit(0, visitor));
+  EXPECT_EQ(search.getDiscoverTime(n - 1), n - 1);
+  EXPECT_EQ(search.getFinishTime(0), 2 * n - 1);
+  EXPECT_EQ(search.getParent(n - 1), n - 2);
 }
@@ -0,0 +1,147 @@
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "../include/algorithms/flowNetwork/Dinic.h"
+#include "../include/algorithms/flowNetwork/GomoryHuTree.h"
+#include "../include/graph/UndirectedGraph.h"
+#include "flow_test_utils.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using Graph = graph::UndirectedGraph<>;
+using Network = graph::FlowNetwork<Graph>;
+using Tree = graph::GomoryHuTree<Graph>;
+using flow_test::Arc;
+using flow_test::randomArcs;
+
+/**
+ * @brief Строит неориентированную сеть: каждое ребро в обе стороны.
+ */
+Network makeNetwork(int n, const std::vector<Arc>& arcs) {
+  return flow_test::makeUndirectedNetwork<Graph>(n, arcs);
+}
+
+int directMinCut(int n, const std::vector<Arc>& arcs, int s, int t) {
+  Network network = makeNetwork(n, arcs);
+  graph::DinicSolver<Graph> dinic(network);
+  return dinic.computeMaxFlow(graph::Vertex(s), graph::Vertex(t));
+}
+
+}  // namespace
+
+TEST(GomoryHuTreeTest, SmallGraph) {
+  // Треугольник 0-1-2 и висячая вершина 3
+  std::vector<Arc> arcs = {{0, 1, 3}, {1, 2, 2}, {0, 2, 4}, {2, 3, 1}};
+  Tree tree(makeNetwork(4, arcs), 1);
+  EXPECT_EQ(tree.getTreeEdges().size(), 3u);
+  EXPECT_EQ(tree.minCutValue(graph::Vertex(0), graph::Vertex(1)), 5);
+  EXPECT_EQ(tree.minCutValue(graph::Vertex(0), graph::Vertex(2)), 6);
+  EXPECT_EQ(tree.minCutValue(graph::Vertex(1), graph::Vertex(2)), 5);
+  EXPECT_EQ(tree.minCutValue(graph::Vertex(3), graph::Vertex(0)), 1);
+  EXPECT_EQ(tree.minCutValue(graph::Vertex(1), graph::Vertex(1)), 0);
+  EXPECT_THROW(tree.minCutValue(graph::Vertex(0), graph::Vertex(9)),
+               std::out_of_range);
+}
+
+TEST(GomoryHuTreeTest, BuildsFromUndirectedGraph) {
+  Graph base;
+  for (int i = 0; i < 4; ++i) {
+    base.addVertex(graph::Vertex(i));
+  }
+  base.addEdge(graph::Vertex(0), graph::Vertex(1), 2);
+  base.addEdge(graph::Vertex(1), graph::Vertex(2), 7);
+  base.addEdge(graph::Vertex(2), graph::Vertex(3), 1);
+
+  Tree tree{Network(base)};
+  EXPECT_EQ(tree.minCutValue(graph::Vertex(0), graph::Vertex(3)), 1);
+  EXPECT_EQ(tree.minCutValue(graph::Vertex(1), graph::Vertex(2)), 7);
+  EXPECT_EQ(tree.minCutValue(graph::Vertex(0), graph::Vertex(2)), 2);
+}
+
+TEST(GomoryHuTreeTest, DisconnectedAndTrivialNetworks) {
+  Tree empty{Network()};
+  EXPECT_TRUE(empty.getTreeEdges().empty());
+
+  Tree tree(makeNetwork(4, {{0, 1, 5}, {2, 3, 4}}), 3);
+  EXPECT_EQ(tree.minCutValue(graph::Vertex(0), graph::Vertex(1)), 5);
+  EXPECT_EQ(tree.minCutValue(graph::Vertex(2), graph::Vertex(3)), 4);
+  EXPECT_EQ(tree.minCutValue(graph::Vertex(1), graph::Vertex(2)), 0);
+}
+
+TEST(GomoryHuTreeTest, AllPairsMatchDirectFlows) {
+  std::mt19937 rng(37);
+  for (int trial = 0; trial < 30; ++trial) {
+    int n = 2 + static_cast<int>(rng() % 14);
+    auto arcs = randomArcs(rng, n, 3 * n, 1, 10);
+    Network network = makeNetwork(n, arcs);
+    Tree sequential(network, 1);
+    Tree parallel(network, 4);
+
+    for (int u = 0; u < n; ++u) {
+      for (int v = u + 1; v < n; ++v) {
+        int expected = directMinCut(n, arcs, u, v);
+        EXPECT_EQ(sequential.minCutValue(graph::Vertex(u), graph::Vertex(v)),
+                  expected);
+        EXPECT_EQ(parallel.minCutValue(graph::Vertex(u), graph::Vertex(v)),
+                  expected);
+      }
+    }
+  }
+}
+
+TEST(GomoryHuTreeTest, TreeEdgesAreMinimumCuts) {
+  // В дереве разрезов каждое ребро дерева задаёт минимальный разрез
+  std::mt19937 rng(38);
+  for (int trial = 0; trial < 30; ++trial) {
+    int n = 2 + static_cast<int>(rng() % 12);
+    auto arcs = randomArcs(rng, n, 3 * n, 1, 10);
+    Tree tree(makeNetwork(n, arcs), 3);
+    auto edges = tree.getTreeEdges();
+    ASSERT_EQ(edges.size(), static_cast<size_t>(n - 1));
+
+    for (size_t removed = 0; removed < edges.size(); ++removed) {
+      // Компонента потомка после удаления ребра
+      std::vector<char> side(n, 0);
+      side[edges[removed].child.id] = 1;
+      for (bool changed = true; changed;) {
+        changed = false;
+        for (size_t i = 0; i < edges.size(); ++i) {
+          if (i == removed) continue;
+          int a = edges[i].child.id;
+          int b = edges[i].parent.id;
+          if (side[a] != side[b]) {
+            side[a] = side[b] = 1;
+            changed = true;
+          }
+        }
+      }
+      int cut = 0;
+      for (const auto& [u, v, capacity] : arcs) {
+        if (side[u] != side[v]) cut += capacity;
+      }
+      EXPECT_EQ(cut, edges[removed].weight);
+    }
+  }
+}
+
+TEST(GomoryHuTreeTest, Int64Capacities) {
+  using Wide = graph::FlowNetwork<Graph, int64_t>;
+  const int64_t big = 5'000'000'000LL;
+  Wide network;
+  for (int i = 0; i < 3; ++i) {
+    network.addVertex(graph::Vertex(i));
+  }
+  for (auto [u, v] : {std::pair{0, 1}, std::pair{1, 2}}) {
+    network.addEdge(graph::Vertex(u), graph::Vertex(v), big);
+    network.addEdge(graph::Vertex(v), graph::Vertex(u), big);
+  }
+  graph::GomoryHuTree<Graph, int64_t> tree(network, 2);
+  EXPECT_EQ(tree.minCutValue(graph::Vertex(0), graph::Vertex(2)), big);
+}
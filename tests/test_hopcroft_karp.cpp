@@ -0,0 +1,188 @@
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../include/algorithms/flowNetwork/Dinic.h"
+#include "../include/algorithms/matching/HopcroftKarp.h"
+#include "../include/graph/DirectedGraph.h"
+#include "../include/graph/UndirectedGraph.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using View = graph::BipartiteView<>;
+using Matcher = graph::HopcroftKarp<>;
+using EdgePairs = std::vector<std::pair<uint32_t, uint32_t>>;
+
+std::vector<graph::Vertex> makeVertices(int first, int count) {
+  std::vector<graph::Vertex> vertices;
+  for (int i = 0; i < count; ++i) {
+    vertices.emplace_back(first + i);
+  }
+  return vertices;
+}
+
+/**
+ * @brief Наибольшее паросочетание через единичную сеть и алгоритм Диница.
+ */
+int matchingByFlow(int left, int right, const EdgePairs& edges) {
+  graph::FlowNetwork<graph::DirectedGraph<>> network;
+  const int source = left + right;
+  const int sink = source + 1;
+  for (int u = 0; u < left; ++u) {
+    network.addEdge(graph::Vertex(source), graph::Vertex(u), 1);
+  }
+  for (int v = 0; v < right; ++v) {
+    network.addEdge(graph::Vertex(left + v), graph::Vertex(sink), 1);
+  }
+  for (const auto& [u, v] : edges) {
+    network.addEdge(graph::Vertex(u), graph::Vertex(left + v), 1);
+  }
+  network.addVertex(graph::Vertex(source));
+  network.addVertex(graph::Vertex(sink));
+  graph::DinicSolver<graph::DirectedGraph<>> dinic(network);
+  return dinic.computeMaxFlow(graph::Vertex(source), graph::Vertex(sink));
+}
+
+/**
+ * @brief Проверяет, что пары образуют паросочетание из рёбер представления.
+ */
+void expectValidMatching(const View& view, const Matcher& matcher,
+                         size_t size) {
+  const auto& matchLeft = matcher.getMatchLeft();
+  const auto& matchRight = matcher.getMatchRight();
+  size_t count = 0;
+  for (size_t u = 0; u < view.leftCount(); ++u) {
+    if (matchLeft[u] == Matcher::kFree) continue;
+    ++count;
+    ASSERT_EQ(matchRight[matchLeft[u]], u);
+    bool adjacent = false;
+    for (size_t i = view.begin(u); i < view.end(u); ++i) {
+      adjacent = adjacent || view.neighbor(i) == matchLeft[u];
+    }
+    ASSERT_TRUE(adjacent);
+  }
+  EXPECT_EQ(count, size);
+}
+
+}  // namespace
+
+TEST(HopcroftKarpTest, RequiresAugmentingPaths) {
+  // Жадный выбор 0-0, 1-1 блокирует; наибольшее паросочетание — 3
+  EdgePairs edges = {{0, 0}, {0, 1}, {1, 1}, {1, 2}, {2, 0}};
+  View view(makeVertices(0, 3), makeVertices(10, 3), edges);
+  for (bool warm : {false, true}) {
+    Matcher matcher(view);
+    size_t size = matcher.computeMaxMatching(warm);
+    EXPECT_EQ(size, 3u);
+    expectValidMatching(view, matcher, size);
+  }
+}
+
+TEST(HopcroftKarpTest, EmptyAndInvalidInput) {
+  View empty({}, {}, {});
+  Matcher matcher(empty);
+  EXPECT_EQ(matcher.computeMaxMatching(), 0u);
+  EXPECT_TRUE(matcher.getMatching().empty());
+
+  EXPECT_THROW(View(makeVertices(0, 1), makeVertices(1, 1), {{0, 1}}),
+               std::out_of_range);
+}
+
+TEST(HopcroftKarpTest, DirectedGraphSidesAreSourcesAndTargets) {
+  // Работники 0..2 -> задачи 10..11
+  graph::DirectedGraph<> graph;
+  for (int v : {0, 1, 2, 10, 11}) {
+    graph.addVertex(graph::Vertex(v));
+  }
+  graph.addEdge(graph::Vertex(0), graph::Vertex(10));
+  graph.addEdge(graph::Vertex(1), graph::Vertex(10));
+  graph.addEdge(graph::Vertex(2), graph::Vertex(10));
+  graph.addEdge(graph::Vertex(2), graph::Vertex(11));
+
+  View view(graph);
+  EXPECT_EQ(view.leftCount(), 3u);
+  EXPECT_EQ(view.rightCount(), 2u);
+  Matcher matcher(view);
+  EXPECT_EQ(matcher.computeMaxMatching(), 2u);
+
+  std::set<int> tasks;
+  for (const auto& [worker, task] : matcher.getMatching()) {
+    EXPECT_TRUE(graph.hasEdge(worker, task));
+    tasks.insert(task.id);
+  }
+  EXPECT_EQ(tasks, (std::set<int>{10, 11}));
+}
+
+TEST(HopcroftKarpTest, UndirectedGraphIsTwoColored) {
+  // Цикл длины 6 и отдельное ребро
+  graph::UndirectedGraph<> graph;
+  for (int v = 0; v < 8; ++v) {
+    graph.addVertex(graph::Vertex(v));
+  }
+  for (int v = 0; v < 6; ++v) {
+    graph.addEdge(graph::Vertex(v), graph::Vertex((v + 1) % 6));
+  }
+  graph.addEdge(graph::Vertex(6), graph::Vertex(7));
+
+  View view(graph);
+  EXPECT_EQ(view.leftCount() + view.rightCount(), 8u);
+  EXPECT_EQ(view.edgeCount(), 7u);
+  Matcher matcher(view);
+  size_t size = matcher.computeMaxMatching();
+  EXPECT_EQ(size, 4u);
+  expectValidMatching(view, matcher, size);
+}
+
+TEST(HopcroftKarpTest, OddCycleIsRejected) {
+  graph::UndirectedGraph<> graph;
+  for (int v = 0; v < 3; ++v) {
+    graph.addVertex(graph::Vertex(v));
+  }
+  graph.addEdge(graph::Vertex(0), graph::Vertex(1));
+  graph.addEdge(graph::Vertex(1), graph::Vertex(2));
+  graph.addEdge(graph::Vertex(2), graph::Vertex(0));
+  EXPECT_THROW(View{graph}, std::invalid_argument);
+}
+
+TEST(HopcroftKarpTest, RandomGraphsMatchMaxFlow) {
+  std::mt19937 rng(40);
+  for (int trial = 0; trial < 100; ++trial) {
+    int left = 1 + static_cast<int>(rng() % 40);
+    int right = 1 + static_cast<int>(rng() % 40);
+    int m = static_cast<int>(rng() % (3 * (left + right)));
+    EdgePairs edges;
+    for (int i = 0; i < m; ++i) {
+      edges.emplace_back(static_cast<uint32_t>(rng() % left),
+                         static_cast<uint32_t>(rng() % right));
+    }
+    int expected = matchingByFlow(left, right, edges);
+
+    View view(makeVertices(0, left), makeVertices(1000, right), edges);
+    for (bool warm : {false, true}) {
+      Matcher matcher(view);
+      size_t size = matcher.computeMaxMatching(warm);
+      EXPECT_EQ(size, static_cast<size_t>(expected));
+      expectValidMatching(view, matcher, size);
+    }
+  }
+}
+
+TEST(HopcroftKarpTest, LargeSparseGraph) {
+  // Совершенное паросочетание i -> i спрятано среди случайных рёбер
+  const int n = 100000;
+  std::mt19937 rng(41);
+  EdgePairs edges;
+  for (int u = 0; u < n; ++u) {
+    edges.emplace_back(static_cast<uint32_t>(rng() % n),
+                       static_cast<uint32_t>(rng() % n));
+    edges.emplace_back(u, u);
+  }
+  View view(makeVertices(0, n), makeVertices(n, n), edges);
+  Matcher matcher(view);
+  size_t size = matcher.computeMaxMatching();
+  EXPECT_EQ(size, static_cast<size_t>(n));
+  expectValidMatching(view, matcher, size);
+}
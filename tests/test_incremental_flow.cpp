@@ -0,0 +1,178 @@
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "../include/algorithms/flowNetwork/Dinic.h"
+#include "../include/algorithms/flowNetwork/EdmondsKarp.h"
+#include "../include/algorithms/flowNetwork/FordFulkerson.h"
+#include "../include/algorithms/flowNetwork/ParallelPushRelabel.h"
+#include "../include/algorithms/flowNetwork/PushRelabel.h"
+#include "../include/graph/DirectedGraph.h"
+#include "flow_test_utils.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using Graph = graph::DirectedGraph<>;
+using Network = graph::FlowNetwork<Graph>;
+using flow_test::Arc;
+using flow_test::expectValidFlow;
+using flow_test::makeNetwork;
+using flow_test::randomArcs;
+
+/**
+ * @brief Дорешивает сеть решателем с номером kind, продолжая текущий поток.
+ */
+int resolve(Network& network, int kind, int s, int t) {
+  graph::Vertex source(s);
+  graph::Vertex sink(t);
+  switch (kind) {
+    case 0:
+      return graph::DinicSolver<Graph>(network).computeMaxFlow(source, sink);
+    case 1:
+      return graph::EdmondsKarp<Graph>(network).computeMaxFlow(source, sink);
+    case 2:
+      return graph::FordFulkerson<Graph>(network).computeMaxFlow(source, sink);
+    case 3:
+      return graph::PushRelabelSolver<Graph>(network).computeMaxFlow(source,
+                                                                     sink);
+    case 4:
+      return graph::PushRelabelSolver<Graph>(network,
+                                             graph::PushRelabelRule::Fifo)
+          .computeMaxFlow(source, sink);
+    default:
+      return graph::ParallelPushRelabelSolver<Graph>(network, 2)
+          .computeMaxFlow(source, sink);
+  }
+}
+
+const int kSolvers = 6;
+
+}  // namespace
+
+TEST(IncrementalFlowTest, FindEdgeAndFlowValue) {
+  Network network = makeNetwork(3, {{0, 1, 5}, {1, 2, 3}});
+  EXPECT_EQ(network.findEdge(graph::Vertex(0), graph::Vertex(1)), 0u);
+  EXPECT_EQ(network.findEdge(graph::Vertex(1), graph::Vertex(2)), 2u);
+  EXPECT_THROW(network.findEdge(graph::Vertex(2), graph::Vertex(1)),
+               std::out_of_range);
+
+  graph::DinicSolver<Graph> dinic(network);
+  EXPECT_EQ(dinic.computeMaxFlow(graph::Vertex(0), graph::Vertex(2)), 3);
+  EXPECT_EQ(network.getFlowValue(network.getVertexIndex(graph::Vertex(0))), 3);
+  EXPECT_EQ(network.getFlowValue(network.getVertexIndex(graph::Vertex(1))), 0);
+  EXPECT_EQ(network.getFlowValue(network.getVertexIndex(graph::Vertex(2))), -3);
+}
+
+TEST(IncrementalFlowTest, IncreaseKeepsFlowAndResolves) {
+  Network network = makeNetwork(3, {{0, 1, 5}, {1, 2, 3}});
+  graph::DinicSolver<Graph> dinic(network);
+  ASSERT_EQ(dinic.computeMaxFlow(graph::Vertex(0), graph::Vertex(2)), 3);
+
+  EXPECT_EQ(network.setCapacity(2, 10, graph::Vertex(0), graph::Vertex(2)), 0);
+  expectValidFlow(network, 0, 2, 3);
+  EXPECT_EQ(dinic.computeMaxFlow(graph::Vertex(0), graph::Vertex(2)), 5);
+  expectValidFlow(network, 0, 2, 5);
+}
+
+TEST(IncrementalFlowTest, DecreaseReroutesAroundEdge) {
+  // Два пути 0-1-3 и 0-2-3 и перемычка 1 -> 2
+  Network network =
+      makeNetwork(4, {{0, 1, 5}, {1, 3, 5}, {0, 2, 10}, {2, 3, 10}, {1, 2, 5}});
+  graph::EdmondsKarp<Graph> solver(network);
+  ASSERT_EQ(solver.computeMaxFlow(graph::Vertex(0), graph::Vertex(3)), 15);
+
+  size_t id = network.findEdge(graph::Vertex(1), graph::Vertex(3));
+  // Обойти ребро 1 -> 3 через 1 -> 2 нельзя: 2 -> 3 уже насыщено
+  int lost = network.setCapacity(id, 0, graph::Vertex(0), graph::Vertex(3));
+  EXPECT_EQ(lost, 5);
+  expectValidFlow(network, 0, 3, 10);
+  EXPECT_EQ(solver.computeMaxFlow(graph::Vertex(0), graph::Vertex(3)), 10);
+}
+
+TEST(IncrementalFlowTest, DecreaseOnSourceAndSinkEdges) {
+  Network network = makeNetwork(3, {{0, 1, 4}, {1, 2, 4}});
+  graph::DinicSolver<Graph> dinic(network);
+  ASSERT_EQ(dinic.computeMaxFlow(graph::Vertex(0), graph::Vertex(2)), 4);
+
+  EXPECT_EQ(network.setCapacity(0, 1, graph::Vertex(0), graph::Vertex(2)), 3);
+  expectValidFlow(network, 0, 2, 1);
+  EXPECT_EQ(network.setCapacity(2, 0, graph::Vertex(0), graph::Vertex(2)), 1);
+  expectValidFlow(network, 0, 2, 0);
+  EXPECT_THROW(network.setCapacity(1, 0, graph::Vertex(0), graph::Vertex(2)),
+               std::out_of_range);
+  EXPECT_THROW(network.setCapacity(4, 0, graph::Vertex(0), graph::Vertex(2)),
+               std::out_of_range);
+}
+
+TEST(IncrementalFlowTest, DecreaseOnCycleThroughSinkAndSource) {
+  // Путь 0 -> 3 и циклы 3 -> 1 -> 3 через сток и 0 -> 2 -> 0 через исток
+  Network network =
+      makeNetwork(4, {{0, 3, 5}, {3, 1, 4}, {1, 3, 4}, {0, 2, 4}, {2, 0, 4}});
+  for (size_t id = 0; id < network.edgeCount(); id += 2) {
+    network.pushFlow(id, id == 0 ? 5 : 3);
+  }
+  expectValidFlow(network, 0, 3, 5);
+
+  size_t fromSink = network.findEdge(graph::Vertex(3), graph::Vertex(1));
+  EXPECT_EQ(network.setCapacity(fromSink, 1, graph::Vertex(0),
+                                graph::Vertex(3)),
+            0);
+  expectValidFlow(network, 0, 3, 5);
+  size_t toSource = network.findEdge(graph::Vertex(2), graph::Vertex(0));
+  EXPECT_EQ(network.setCapacity(toSource, 0, graph::Vertex(0),
+                                graph::Vertex(3)),
+            0);
+  expectValidFlow(network, 0, 3, 5);
+  EXPECT_EQ(network.getFlow(graph::Vertex(0), graph::Vertex(2)), 0);
+}
+
+TEST(IncrementalFlowTest, DecreaseOnSinkToSourceEdgeRaisesFlow) {
+  // Поток идёт из стока 1 в исток 0, его величина для пары (0, 1) равна -3
+  Network network = makeNetwork(2, {{1, 0, 3}, {0, 1, 2}});
+  network.pushFlow(0, 3);
+  expectValidFlow(network, 0, 1, -3);
+
+  EXPECT_EQ(network.setCapacity(0, 1, graph::Vertex(0), graph::Vertex(1)), -2);
+  expectValidFlow(network, 0, 1, -1);
+  graph::DinicSolver<Graph> dinic(network);
+  EXPECT_EQ(dinic.computeMaxFlow(graph::Vertex(0), graph::Vertex(1)), 2);
+}
+
+TEST(IncrementalFlowTest, RandomUpdatesMatchFreshSolve) {
+  std::mt19937 rng(36);
+  for (int trial = 0; trial < 60; ++trial) {
+    int n = 2 + static_cast<int>(rng() % 25);
+    int m = static_cast<int>(rng() % (5 * n));
+    auto arcs = randomArcs(rng, n, m, 0, 19);
+    int s = static_cast<int>(rng() % n);
+    int t = static_cast<int>(rng() % n);
+    if (s == t || arcs.empty()) continue;
+
+    for (int kind = 0; kind < kSolvers; ++kind) {
+      std::vector<Arc> current = arcs;
+      Network network = makeNetwork(n, current);
+      int value = resolve(network, kind, s, t);
+
+      for (int update = 0; update < 15; ++update) {
+        size_t index = rng() % current.size();
+        int capacity = static_cast<int>(rng() % 25);
+        std::get<2>(current[index]) = capacity;
+
+        int lost = network.setCapacity(2 * index, capacity, graph::Vertex(s),
+                                       graph::Vertex(t));
+        ASSERT_GE(lost, 0);
+        expectValidFlow(network, s, t, value - lost);
+
+        Network reference = makeNetwork(n, current);
+        graph::DinicSolver<Graph> dinic(reference);
+        int expected = dinic.computeMaxFlow(graph::Vertex(s), graph::Vertex(t));
+
+        value = resolve(network, kind, s, t);
+        ASSERT_EQ(value, expected) << "solver " << kind;
+        expectValidFlow(network, s, t, value);
+      }
+    }
+  }
+}
@@ -0,0 +1,113 @@
+#include <cmath>
+#include <random>
+#include <set>
+
+#include "../include/algorithms/similarity/LinkPrediction.h"
+#include "../include/algorithms/similarity/SortedSetIntersection.h"
+#include "../include/graph/AdjacencyListGraph.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+std::vector<int32_t> randomSortedSet(std::mt19937& rng, size_t size,
+                                     int32_t range) {
+  std::set<int32_t> values;
+  std::uniform_int_distribution<int32_t> dist(0, range);
+  while (values.size() < size) {
+    values.insert(dist(rng));
+  }
+  return std::vector<int32_t>(values.begin(), values.end());
+}
+
+graph::AdjacencyListGraph<graph::Vertex, graph::Edge> makeGraph() {
+  // Неориентированный граф: 1-3, 1-4, 1-5, 2-3, 2-4, 3-4, 5-6
+  graph::AdjacencyListGraph<graph::Vertex, graph::Edge> graph(true);
+  for (int i = 1; i <= 6; ++i) {
+    graph.addVertex(graph::Vertex(i));
+  }
+  const int edges[][2] = {{1, 3}, {1, 4}, {1, 5}, {2, 3},
+                          {2, 4}, {3, 4}, {5, 6}};
+  for (const auto& e : edges) {
+    graph.addEdge(graph::Vertex(e[0]), graph::Vertex(e[1]));
+    graph.addEdge(graph::Vertex(e[1]), graph::Vertex(e[0]));
+  }
+  return graph;
+}
+
+}  // namespace
+
+TEST(SortedSetIntersectionTest, MatchesScalarMerge) {
+  std::mt19937 rng(42);
+  for (int iteration = 0; iteration < 200; ++iteration) {
+    auto a = randomSortedSet(rng, rng() % 100, 300);
+    auto b = randomSortedSet(rng, rng() % 100, 300);
+    EXPECT_EQ(graph::intersectSortedCount(a.data(), a.size(), b.data(),
+                                          b.size()),
+              graph::intersectSortedCountScalar(a.data(), a.size(), b.data(),
+                                                b.size()));
+  }
+}
+
+TEST(SortedSetIntersectionTest, DisjointAndIdentical) {
+  std::vector<int32_t> even;
+  std::vector<int32_t> odd;
+  for (int32_t i = 0; i < 64; ++i) {
+    even.push_back(2 * i);
+    odd.push_back(2 * i + 1);
+  }
+  EXPECT_EQ(graph::intersectSortedCount(even.data(), even.size(), odd.data(),
+                                        odd.size()),
+            0u);
+  EXPECT_EQ(graph::intersectSortedCount(even.data(), even.size(), even.data(),
+                                        even.size()),
+            64u);
+}
+
+TEST(LinkPredictionTest, CommonNeighborsAndJaccard) {
+  auto graph = makeGraph();
+  EXPECT_EQ(graph::commonNeighborCount(graph, graph::Vertex(1),
+                                       graph::Vertex(2)),
+            2u);
+  EXPECT_DOUBLE_EQ(
+      graph::jaccardCoefficient(graph, graph::Vertex(1), graph::Vertex(2)),
+      2.0 / 3.0);
+  EXPECT_DOUBLE_EQ(
+      graph::jaccardCoefficient(graph, graph::Vertex(2), graph::Vertex(6)),
+      0.0);
+}
+
+TEST(LinkPredictionTest, AdamicAdar) {
+  auto graph = makeGraph();
+  // Общие соседи 1 и 2 — вершины 3 и 4, у каждой по три соседа.
+  EXPECT_DOUBLE_EQ(
+      graph::adamicAdarIndex(graph, graph::Vertex(1), graph::Vertex(2)),
+      2.0 / std::log(3.0));
+  // Общий сосед 1 и 6 — вершина 5 степени 2.
+  EXPECT_DOUBLE_EQ(
+      graph::adamicAdarIndex(graph, graph::Vertex(1), graph::Vertex(6)),
+      1.0 / std::log(2.0));
+}
+
+TEST(LinkPredictionTest, BatchScores) {
+  auto graph = makeGraph();
+  std::vector<std::pair<graph::Vertex, graph::Vertex>> pairs = {
+      {graph::Vertex(1), graph::Vertex(2)},
+      {graph::Vertex(3), graph::Vertex(4)},
+      {graph::Vertex(2), graph::Vertex(6)}};
+  auto scores = graph::computeLinkScores(graph, pairs, 2);
+  ASSERT_EQ(scores.size(), 3u);
+  EXPECT_EQ(scores[0].commonNeighbors, 2u);
+  EXPECT_EQ(scores[1].commonNeighbors, 2u);
+  EXPECT_EQ(scores[2].commonNeighbors, 0u);
+  EXPECT_DOUBLE_EQ(scores[0].adamicAdar, 2.0 / std::log(3.0));
+  EXPECT_DOUBLE_EQ(scores[2].jaccard, 0.0);
+}
+
+TEST(LinkPredictionTest, RequiresSortedNeighbors) {
+  graph::AdjacencyListGraph<graph::Vertex, graph::Edge> graph;
+  graph.addVertex(graph::Vertex(1));
+  graph.addVertex(graph::Vertex(2));
+  EXPECT_THROW(
+      graph::commonNeighborCount(graph, graph::Vertex(1), graph::Vertex(2)),
+      std::logic_error);
+}
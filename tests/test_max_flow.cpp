@@ -0,0 +1,370 @@
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "../include/algorithms/flowNetwork/Dinic.h"
+#include "../include/algorithms/flowNetwork/EdmondsKarp.h"
+#include "../include/algorithms/flowNetwork/FordFulkerson.h"
+#include "../include/graph/DirectedGraph.h"
+#include "../include/graph/UndirectedGraph.h"
+#include "flow_test_utils.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using Network = graph::FlowNetwork<graph::DirectedGraph<>>;
+using flow_test::Arc;
+using flow_test::expectValidFlow;
+using flow_test::makeNetwork;
+using flow_test::randomArcs;
+
+/**
+ * @brief Минимальный разрез полным перебором подмножеств (для малых n).
+ */
+int bruteForceMinCut(int n, const std::vector<Arc>& arcs, int s, int t) {
+  int best = INT_MAX;
+  for (int mask = 0; mask < (1 << n); ++mask) {
+    if (!(mask >> s & 1) || (mask >> t & 1)) continue;
+    int cut = 0;
+    for (const auto& [from, to, capacity] : arcs) {
+      if ((mask >> from & 1) && !(mask >> to & 1)) cut += capacity;
+    }
+    best = std::min(best, cut);
+  }
+  return best;
+}
+
+const std::vector<Arc> kClassicArcs = {
+    {0, 1, 16}, {0, 2, 13}, {1, 2, 10}, {2, 1, 4}, {1, 3, 12},
+    {3, 2, 9},  {2, 4, 14}, {4, 3, 7},  {3, 5, 20}, {4, 5, 4}};
+
+}  // namespace
+
+TEST(FlowNetworkTest, ReverseEdgesArePaired) {
+  Network network = makeNetwork(3, {{0, 1, 5}, {1, 2, 3}, {0, 2, 1}});
+  network.buildArcIndex();
+  EXPECT_EQ(network.vertexCount(), 3u);
+  EXPECT_EQ(network.edgeCount(), 6u);
+  for (size_t id = 0; id < network.edgeCount(); ++id) {
+    size_t reverse = Network::reverseEdge(id);
+    EXPECT_EQ(network.getEdge(reverse).target, network.getTail(id));
+    EXPECT_EQ(network.getEdge(id).target, network.getTail(reverse));
+  }
+  EXPECT_EQ(network.getArcs(0).size(), 2u);
+  EXPECT_EQ(network.getArcs(1).size(), 2u);
+  EXPECT_EQ(network.getArcs(2).size(), 2u);
+  for (size_t v = 0; v < 3; ++v) {
+    for (uint32_t id : network.getArcs(v)) {
+      EXPECT_EQ(network.getTail(id), v);
+    }
+  }
+  EXPECT_THROW(network.getVertexIndex(graph::Vertex(9)), std::out_of_range);
+}
+
+TEST(FlowNetworkTest, BuildsFromBaseGraph) {
+  graph::DirectedGraph<> base;
+  for (int i = 0; i < 4; ++i) {
+    base.addVertex(graph::Vertex(i));
+  }
+  base.addEdge(graph::Vertex(0), graph::Vertex(1), 3);
+  base.addEdge(graph::Vertex(1), graph::Vertex(3), 2);
+  base.addEdge(graph::Vertex(0), graph::Vertex(2), 2);
+  base.addEdge(graph::Vertex(2), graph::Vertex(3), 4);
+
+  graph::FlowNetwork<graph::DirectedGraph<>> network(base);
+  EXPECT_EQ(network.vertexCount(), 4u);
+  EXPECT_EQ(network.edgeCount(), 8u);
+
+  graph::DinicSolver<graph::DirectedGraph<>> solver(network);
+  EXPECT_EQ(solver.computeMaxFlow(graph::Vertex(0), graph::Vertex(3)), 4);
+  EXPECT_EQ(network.getFlow(graph::Vertex(0), graph::Vertex(1)), 2);
+  EXPECT_EQ(network.getFlow(graph::Vertex(2), graph::Vertex(3)), 2);
+}
+
+TEST(FlowNetworkTest, UndirectedBaseGraphUsesBothDirections) {
+  graph::UndirectedGraph<> base;
+  for (int i = 0; i < 3; ++i) {
+    base.addVertex(graph::Vertex(i));
+  }
+  base.addEdge(graph::Vertex(1), graph::Vertex(0), 5);
+  base.addEdge(graph::Vertex(2), graph::Vertex(1), 3);
+
+  graph::FlowNetwork<graph::UndirectedGraph<>> network(base);
+  graph::EdmondsKarp<graph::UndirectedGraph<>> solver(network);
+  EXPECT_EQ(solver.computeMaxFlow(graph::Vertex(0), graph::Vertex(2)), 3);
+}
+
+TEST(MaxFlowTest, ClassicNetwork) {
+  Network dinicNetwork = makeNetwork(6, kClassicArcs);
+  graph::DinicSolver<graph::DirectedGraph<>> dinic(dinicNetwork);
+  EXPECT_EQ(dinic.computeMaxFlow(graph::Vertex(0), graph::Vertex(5)), 23);
+  expectValidFlow(dinicNetwork, 0, 5, 23);
+
+  Network ekNetwork = makeNetwork(6, kClassicArcs);
+  graph::EdmondsKarp<graph::DirectedGraph<>> edmondsKarp(ekNetwork);
+  EXPECT_EQ(edmondsKarp.computeMaxFlow(graph::Vertex(0), graph::Vertex(5)),
+            23);
+  expectValidFlow(ekNetwork, 0, 5, 23);
+
+  Network ffNetwork = makeNetwork(6, kClassicArcs);
+  graph::FordFulkerson<graph::DirectedGraph<>> fordFulkerson(ffNetwork);
+  EXPECT_EQ(fordFulkerson.computeMaxFlow(graph::Vertex(0), graph::Vertex(5)),
+            23);
+  expectValidFlow(ffNetwork, 0, 5, 23);
+}
+
+TEST(MaxFlowTest, UnreachableSinkAndSameVertex) {
+  Network network = makeNetwork(4, {{0, 1, 5}, {2, 3, 5}});
+  graph::DinicSolver<graph::DirectedGraph<>> dinic(network);
+  EXPECT_EQ(dinic.computeMaxFlow(graph::Vertex(0), graph::Vertex(3)), 0);
+  EXPECT_EQ(dinic.computeMaxFlow(graph::Vertex(0), graph::Vertex(0)), 0);
+
+  graph::EdmondsKarp<graph::DirectedGraph<>> edmondsKarp(network);
+  EXPECT_EQ(edmondsKarp.computeMaxFlow(graph::Vertex(0), graph::Vertex(3)), 0);
+  graph::FordFulkerson<graph::DirectedGraph<>> fordFulkerson(network);
+  EXPECT_EQ(fordFulkerson.computeMaxFlow(graph::Vertex(0), graph::Vertex(3)),
+            0);
+  EXPECT_THROW(dinic.computeMaxFlow(graph::Vertex(0), graph::Vertex(7)),
+               std::out_of_range);
+}
+
+TEST(MaxFlowTest, ParallelAndAntiparallelEdges) {
+  std::vector<Arc> arcs = {{0, 1, 2}, {0, 1, 3}, {1, 0, 4}, {1, 2, 10}};
+  Network network = makeNetwork(3, arcs);
+  graph::DinicSolver<graph::DirectedGraph<>> dinic(network);
+  EXPECT_EQ(dinic.computeMaxFlow(graph::Vertex(0), graph::Vertex(2)), 5);
+  expectValidFlow(network, 0, 2, 5);
+}
+
+TEST(MaxFlowTest, ManyEdgesAddedIncrementally) {
+  // Раньше обратные рёбра хранились указателями и портились при росте списков
+  Network network;
+  const int layers = 50;
+  const int width = 20;
+  for (int layer = 0; layer + 1 < layers; ++layer) {
+    for (int i = 0; i < width; ++i) {
+      for (int j = 0; j < width; ++j) {
+        network.addEdge(graph::Vertex(layer * width + i),
+                        graph::Vertex((layer + 1) * width + j), 1);
+      }
+    }
+  }
+  int source = layers * width;
+  int sink = source + 1;
+  for (int i = 0; i < width; ++i) {
+    network.addEdge(graph::Vertex(source), graph::Vertex(i), 3);
+    network.addEdge(graph::Vertex((layers - 1) * width + i),
+                    graph::Vertex(sink), 2);
+  }
+  graph::DinicSolver<graph::DirectedGraph<>> dinic(network);
+  EXPECT_EQ(dinic.computeMaxFlow(graph::Vertex(source), graph::Vertex(sink)),
+            2 * width);
+  expectValidFlow(network, source, sink, 2 * width);
+}
+
+TEST(MaxFlowTest, RandomNetworksMatchBruteForceCut) {
+  std::mt19937 rng(31);
+  for (int trial = 0; trial < 60; ++trial) {
+    int n = 2 + static_cast<int>(rng() % 8);
+    auto arcs = randomArcs(rng, n, 3 * n, 1, 10);
+    int expected = bruteForceMinCut(n, arcs, 0, n - 1);
+
+    Network dinicNetwork = makeNetwork(n, arcs);
+    graph::DinicSolver<graph::DirectedGraph<>> dinic(dinicNetwork);
+    EXPECT_EQ(dinic.computeMaxFlow(graph::Vertex(0), graph::Vertex(n - 1)),
+              expected);
+    expectValidFlow(dinicNetwork, 0, n - 1, expected);
+
+    Network ekNetwork = makeNetwork(n, arcs);
+    graph::EdmondsKarp<graph::DirectedGraph<>> edmondsKarp(ekNetwork);
+    EXPECT_EQ(
+        edmondsKarp.computeMaxFlow(graph::Vertex(0), graph::Vertex(n - 1)),
+        expected);
+
+    Network ffNetwork = makeNetwork(n, arcs);
+    graph::FordFulkerson<graph::DirectedGraph<>> fordFulkerson(ffNetwork);
+    EXPECT_EQ(
+        fordFulkerson.computeMaxFlow(graph::Vertex(0), graph::Vertex(n - 1)),
+        expected);
+  }
+}
+
+TEST(MaxFlowTest, DinicOnDeepLayeredGraph) {
+  // Длинная цепочка из двух параллельных путей: рекурсивный DFS переполнил
+  // бы стек
+  const int length = 200000;
+  Network network;
+  for (int i = 0; i < length; ++i) {
+    network.addEdge(graph::Vertex(i), graph::Vertex(i + 1), 3);
+    network.addEdge(graph::Vertex(i), graph::Vertex(i + 1), 2);
+  }
+  graph::DinicSolver<graph::DirectedGraph<>> dinic(network);
+  EXPECT_EQ(dinic.computeMaxFlow(graph::Vertex(0), graph::Vertex(length)), 5);
+  expectValidFlow(network, 0, length, 5);
+}
+
+TEST(MinCutTest, ClassicNetworkCut) {
+  Network network = makeNetwork(6, kClassicArcs);
+  graph::DinicSolver<graph::DirectedGraph<>> dinic(network);
+  ASSERT_EQ(dinic.computeMaxFlow(graph::Vertex(0), graph::Vertex(5)), 23);
+
+  auto side = network.getMinCutSourceSide(graph::Vertex(0));
+  std::vector<int> ids;
+  for (const auto& v : side) ids.push_back(v.id);
+  std::sort(ids.begin(), ids.end());
+  EXPECT_EQ(ids, (std::vector<int>{0, 1, 2, 4}));
+
+  int capacity = 0;
+  for (size_t id : network.getMinCutEdges(graph::Vertex(0))) {
+    capacity += network.getEdge(id).capacity;
+  }
+  EXPECT_EQ(capacity, 23);
+}
+
+TEST(MinCutTest, RandomCutsMatchFlowValue) {
+  std::mt19937 rng(37);
+  for (int trial = 0; trial < 60; ++trial) {
+    int n = 2 + static_cast<int>(rng() % 8);
+    auto arcs = randomArcs(rng, n, 3 * n, 1, 10);
+    Network network = makeNetwork(n, arcs);
+    graph::DinicSolver<graph::DirectedGraph<>> dinic(network);
+    int flow = dinic.computeMaxFlow(graph::Vertex(0), graph::Vertex(n - 1));
+
+    auto side = network.findSourceSide(0);
+    EXPECT_TRUE(side[0]);
+    EXPECT_FALSE(side[network.getVertexIndex(graph::Vertex(n - 1))]);
+    int capacity = 0;
+    for (size_t id : network.getMinCutEdges(graph::Vertex(0))) {
+      const auto& e = network.getEdge(id);
+      EXPECT_EQ(e.flow, e.capacity);
+      capacity += e.capacity;
+    }
+    EXPECT_EQ(capacity, flow);
+  }
+}
+
+TEST(CapacityTypeTest, CompactEdgeForInt) {
+  EXPECT_EQ(sizeof(Network::FlowEdge), 12u);
+  EXPECT_EQ(
+      sizeof(graph::FlowNetwork<graph::DirectedGraph<>, int64_t>::FlowEdge),
+      24u);
+}
+
+TEST(CapacityTypeTest, Int64CapacitiesBeyondInt32) {
+  using Wide = graph::FlowNetwork<graph::DirectedGraph<>, int64_t>;
+  const int64_t big = 3'000'000'000LL;
+  auto build = [&] {
+    Wide network;
+    network.addEdge(graph::Vertex(0), graph::Vertex(1), big);
+    network.addEdge(graph::Vertex(0), graph::Vertex(2), big);
+    network.addEdge(graph::Vertex(1), graph::Vertex(3), big);
+    network.addEdge(graph::Vertex(2), graph::Vertex(3), 2 * big);
+    network.addEdge(graph::Vertex(1), graph::Vertex(2), big);
+    return network;
+  };
+
+  Wide dinicNetwork = build();
+  graph::DinicSolver<graph::DirectedGraph<>, int64_t> dinic(dinicNetwork);
+  EXPECT_EQ(dinic.computeMaxFlow(graph::Vertex(0), graph::Vertex(3)), 2 * big);
+
+  Wide ekNetwork = build();
+  graph::EdmondsKarp<graph::DirectedGraph<>, int64_t> edmondsKarp(ekNetwork);
+  EXPECT_EQ(edmondsKarp.computeMaxFlow(graph::Vertex(0), graph::Vertex(3)),
+            2 * big);
+
+  Wide ffNetwork = build();
+  graph::FordFulkerson<graph::DirectedGraph<>, int64_t> fordFulkerson(
+      ffNetwork);
+  EXPECT_EQ(fordFulkerson.computeMaxFlow(graph::Vertex(0), graph::Vertex(3)),
+            2 * big);
+  EXPECT_EQ(ffNetwork.getFlowValue(0), 2 * big);
+}
+
+TEST(CapacityTypeTest, DoubleCapacitiesMatchScaledIntegers) {
+  using Real = graph::FlowNetwork<graph::DirectedGraph<>, double>;
+  std::mt19937 rng(38);
+  for (int trial = 0; trial < 60; ++trial) {
+    int n = 2 + static_cast<int>(rng() % 12);
+    auto arcs = randomArcs(rng, n, 4 * n, 1, 20);
+    Network integral = makeNetwork(n, arcs);
+    graph::DinicSolver<graph::DirectedGraph<>> reference(integral);
+    int expected =
+        reference.computeMaxFlow(graph::Vertex(0), graph::Vertex(n - 1));
+
+    // Ёмкости в десятых долях: 0.1 не представима точно в double
+    Real network;
+    for (int i = 0; i < n; ++i) {
+      network.addVertex(graph::Vertex(i));
+    }
+    for (const auto& [from, to, capacity] : arcs) {
+      network.addEdge(graph::Vertex(from), graph::Vertex(to), capacity * 0.1);
+    }
+    Real ekNetwork = network;
+    Real ffNetwork = network;
+
+    graph::DinicSolver<graph::DirectedGraph<>, double> dinic(network);
+    EXPECT_NEAR(dinic.computeMaxFlow(graph::Vertex(0), graph::Vertex(n - 1)),
+                expected * 0.1, 1e-6);
+    graph::EdmondsKarp<graph::DirectedGraph<>, double> edmondsKarp(ekNetwork);
+    EXPECT_NEAR(
+        edmondsKarp.computeMaxFlow(graph::Vertex(0), graph::Vertex(n - 1)),
+        expected * 0.1, 1e-6);
+    graph::FordFulkerson<graph::DirectedGraph<>, double> fordFulkerson(
+        ffNetwork);
+    EXPECT_NEAR(
+        fordFulkerson.computeMaxFlow(graph::Vertex(0), graph::Vertex(n - 1)),
+        expected * 0.1, 1e-6);
+
+    double cut = 0;
+    for (size_t id : network.getMinCutEdges(graph::Vertex(0))) {
+      cut += network.getEdge(id).capacity;
+    }
+    EXPECT_NEAR(cut, expected * 0.1, 1e-6);
+  }
+}
+
+TEST(MaxFlowTest, FordFulkersonScalesOnHighCapacities) {
+  // Без масштабирования DFS может чередовать пути через ребро 1 <-> 2
+  // и делать по единице потока за раз
+  using Wide = graph::FlowNetwork<graph::DirectedGraph<>, int64_t>;
+  const int64_t big = 1'000'000'000'000LL;
+  Wide network;
+  network.addEdge(graph::Vertex(0), graph::Vertex(1), big);
+  network.addEdge(graph::Vertex(1), graph::Vertex(2), 1);
+  network.addEdge(graph::Vertex(2), graph::Vertex(1), 1);
+  network.addEdge(graph::Vertex(0), graph::Vertex(2), big);
+  network.addEdge(graph::Vertex(1), graph::Vertex(3), big);
+  network.addEdge(graph::Vertex(2), graph::Vertex(3), big);
+
+  graph::FordFulkerson<graph::DirectedGraph<>, int64_t> fordFulkerson(network);
+  EXPECT_EQ(fordFulkerson.computeMaxFlow(graph::Vertex(0), graph::Vertex(3)),
+            2 * big);
+}
+
+TEST(MaxFlowTest, FordFulkersonMatchesDinicOnWideCapacityRange) {
+  std::mt19937 rng(39);
+  for (int trial = 0; trial < 40; ++trial) {
+    int n = 2 + static_cast<int>(rng() % 30);
+    std::vector<Arc> arcs;
+    for (int i = 0; i < 5 * n; ++i) {
+      int from = static_cast<int>(rng() % n);
+      int to = static_cast<int>(rng() % n);
+      // Ёмкости от 1 до 2^20 разного порядка
+      int capacity = 1 << (rng() % 21);
+      if (from != to) arcs.emplace_back(from, to, capacity);
+    }
+    Network reference = makeNetwork(n, arcs);
+    graph::DinicSolver<graph::DirectedGraph<>> dinic(reference);
+    int expected = dinic.computeMaxFlow(graph::Vertex(0), graph::Vertex(n - 1));
+
+    Network network = makeNetwork(n, arcs);
+    graph::FordFulkerson<graph::DirectedGraph<>> fordFulkerson(network);
+    EXPECT_EQ(
+        fordFulkerson.computeMaxFlow(graph::Vertex(0), graph::Vertex(n - 1)),
+        expected);
+    expectValidFlow(network, 0, n - 1, expected);
+  }
+}
@@ -0,0 +1,195 @@
+#include <random>
+#include <utility>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "../include/algorithms/flowNetwork/Dinic.h"
+#include "../include/algorithms/flowNetwork/MinCostFlow.h"
+#include "../include/graph/DirectedGraph.h"
+#include "flow_test_utils.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using Network = graph::FlowNetwork<graph::DirectedGraph<>>;
+using Solver = graph::MinCostFlowSolver<graph::DirectedGraph<>>;
+using Arc = flow_test::CostArc;
+using flow_test::makeNetwork;
+
+/**
+ * @brief Проверяет отсутствие циклов отрицательной стоимости в остаточной
+ * сети — критерий оптимальности потока.
+ */
+bool hasNegativeResidualCycle(const Network& network) {
+  const size_t n = network.vertexCount();
+  std::vector<long long> distance(n, 0);
+  for (size_t round = 0; round < n; ++round) {
+    bool changed = false;
+    for (size_t id = 0; id < network.edgeCount(); ++id) {
+      const auto& e = network.getEdge(id);
+      if (e.residual() <= 0) continue;
+      long long candidate = distance[network.getTail(id)] + network.getCost(id);
+      if (candidate < distance[e.target]) {
+        distance[e.target] = candidate;
+        changed = true;
+      }
+    }
+    if (!changed) return false;
+  }
+  return true;
+}
+
+const graph::MinCostFlowMethod kMethods[] = {
+    graph::MinCostFlowMethod::SuccessiveShortestPaths,
+    graph::MinCostFlowMethod::CostScaling};
+
+}  // namespace
+
+TEST(MinCostFlowTest, CostsAreStoredOnlyWhenSet) {
+  Network network = makeNetwork(3, std::vector<flow_test::Arc>{{0, 1, 5}});
+  EXPECT_EQ(network.getCost(0), 0);
+  EXPECT_EQ(network.getCost(1), 0);
+
+  size_t id = network.addEdge(graph::Vertex(1), graph::Vertex(2), 4, 7);
+  EXPECT_EQ(network.getCost(0), 0);
+  EXPECT_EQ(network.getCost(id), 7);
+  EXPECT_EQ(network.getCost(Network::reverseEdge(id)), -7);
+  id = network.addEdge(graph::Vertex(0), graph::Vertex(2), 1);
+  EXPECT_EQ(network.getCost(id), 0);
+}
+
+TEST(MinCostFlowTest, ChoosesCheaperRoutes) {
+  // Два пути по 2 единицы: дешёвый 0-1-3 и дорогой 0-2-3
+  std::vector<Arc> arcs = {
+      {0, 1, 2, 1}, {1, 3, 2, 1}, {0, 2, 2, 5}, {2, 3, 2, 5}, {1, 2, 1, 1}};
+  for (auto method : kMethods) {
+    Network network = makeNetwork(4, arcs);
+    Solver solver(network, method);
+    auto result =
+        solver.computeMinCostMaxFlow(graph::Vertex(0), graph::Vertex(3));
+    EXPECT_EQ(result.flow, 4);
+    EXPECT_EQ(result.cost, 2 * 2 + 2 * 10);
+    ASSERT_EQ(result.edgeFlows.size(), arcs.size());
+    EXPECT_EQ(result.edgeFlows[0], 2);
+    EXPECT_EQ(result.edgeFlows[4], 0);
+  }
+}
+
+TEST(MinCostFlowTest, NegativeCostsWithoutCycles) {
+  std::vector<Arc> arcs = {
+      {0, 1, 3, -2}, {1, 2, 2, 1}, {0, 2, 2, 1}, {1, 3, 2, 4}, {2, 3, 4, 0}};
+  for (auto method : kMethods) {
+    Network network = makeNetwork(4, arcs);
+    Solver solver(network, method);
+    auto result =
+        solver.computeMinCostMaxFlow(graph::Vertex(0), graph::Vertex(3));
+    EXPECT_EQ(result.flow, 5);
+    // 2 по 0-1-2-3 (-1), 1 по 0-1-3 (2), 2 по 0-2-3 (1)
+    EXPECT_EQ(result.cost, 2 * -1 + 1 * 2 + 2 * 1);
+    EXPECT_FALSE(hasNegativeResidualCycle(network));
+  }
+}
+
+TEST(MinCostFlowTest, NegativeCycleHandledByCostScaling) {
+  std::vector<Arc> arcs = {{0, 1, 1, 1}, {1, 2, 5, 1}, {2, 3, 5, -3},
+                           {3, 1, 5, 1}, {1, 4, 1, 1}};
+  Network sspNetwork = makeNetwork(5, arcs);
+  Solver ssp(sspNetwork);
+  EXPECT_THROW(ssp.computeMinCostMaxFlow(graph::Vertex(0), graph::Vertex(4)),
+               std::runtime_error);
+
+  Network network = makeNetwork(5, arcs);
+  Solver scaling(network, graph::MinCostFlowMethod::CostScaling);
+  auto result =
+      scaling.computeMinCostMaxFlow(graph::Vertex(0), graph::Vertex(4));
+  EXPECT_EQ(result.flow, 1);
+  EXPECT_EQ(result.cost, 2 + 5 * -1);
+  EXPECT_FALSE(hasNegativeResidualCycle(network));
+}
+
+TEST(MinCostFlowTest, ManyRelaxationsWithoutNegativeCycle) {
+  // Ациклическая сеть: вершину 6 улучшают через каждое ui, а каждое ui —
+  // ещё раз через вершину 5, так что улучшений больше, чем вершин
+  std::vector<Arc> arcs;
+  for (int i = 1; i <= 4; ++i) {
+    arcs.emplace_back(0, i, 1, 0);
+    arcs.emplace_back(i, 6, 1, -i);
+    arcs.emplace_back(5, i, 1, -100);
+  }
+  arcs.emplace_back(0, 5, 1, 0);
+  arcs.emplace_back(6, 7, 10, 0);
+  for (auto method : kMethods) {
+    Network network = makeNetwork(8, arcs);
+    Solver solver(network, method);
+    auto result =
+        solver.computeMinCostMaxFlow(graph::Vertex(0), graph::Vertex(7));
+    EXPECT_EQ(result.flow, 4);
+    EXPECT_EQ(result.cost, -110);
+    EXPECT_FALSE(hasNegativeResidualCycle(network));
+  }
+}
+
+TEST(MinCostFlowTest, RandomAcyclicNegativeCostsAgree) {
+  std::mt19937 rng(135);
+  for (int trial = 0; trial < 80; ++trial) {
+    int n = 2 + static_cast<int>(rng() % 30);
+    std::vector<Arc> arcs;
+    for (int i = 0; i < 4 * n; ++i) {
+      int from = static_cast<int>(rng() % n);
+      int to = static_cast<int>(rng() % n);
+      if (from == to) continue;
+      // Рёбра идут только вперёд, поэтому отрицательных циклов нет
+      if (from > to) std::swap(from, to);
+      arcs.emplace_back(from, to, static_cast<int>(rng() % 10),
+                        static_cast<int>(rng() % 41) - 30);
+    }
+
+    Network sspNetwork = makeNetwork(n, arcs);
+    Solver ssp(sspNetwork);
+    auto expected =
+        ssp.computeMinCostMaxFlow(graph::Vertex(0), graph::Vertex(n - 1));
+    EXPECT_FALSE(hasNegativeResidualCycle(sspNetwork));
+
+    Network network = makeNetwork(n, arcs);
+    Solver scaling(network, graph::MinCostFlowMethod::CostScaling);
+    auto result =
+        scaling.computeMinCostMaxFlow(graph::Vertex(0), graph::Vertex(n - 1));
+    EXPECT_EQ(result.flow, expected.flow);
+    EXPECT_EQ(result.cost, expected.cost);
+  }
+}
+
+TEST(MinCostFlowTest, RandomNetworksAgree) {
+  std::mt19937 rng(35);
+  for (int trial = 0; trial < 80; ++trial) {
+    int n = 2 + static_cast<int>(rng() % 30);
+    std::vector<Arc> arcs;
+    for (int i = 0; i < 4 * n; ++i) {
+      int from = static_cast<int>(rng() % n);
+      int to = static_cast<int>(rng() % n);
+      if (from == to) continue;
+      arcs.emplace_back(from, to, static_cast<int>(rng() % 10),
+                        static_cast<int>(rng() % 20));
+    }
+
+    Network reference = makeNetwork(n, arcs);
+    graph::DinicSolver<graph::DirectedGraph<>> dinic(reference);
+    int maxFlow = dinic.computeMaxFlow(graph::Vertex(0), graph::Vertex(n - 1));
+
+    Network sspNetwork = makeNetwork(n, arcs);
+    Solver ssp(sspNetwork);
+    auto expected =
+        ssp.computeMinCostMaxFlow(graph::Vertex(0), graph::Vertex(n - 1));
+    EXPECT_EQ(expected.flow, maxFlow);
+    EXPECT_FALSE(hasNegativeResidualCycle(sspNetwork));
+
+    Network network = makeNetwork(n, arcs);
+    Solver scaling(network, graph::MinCostFlowMethod::CostScaling);
+    auto result =
+        scaling.computeMinCostMaxFlow(graph::Vertex(0), graph::Vertex(n - 1));
+    EXPECT_EQ(result.flow, maxFlow);
+    EXPECT_EQ(result.cost, expected.cost);
+    EXPECT_FALSE(hasNegativeResidualCycle(network));
+  }
+}
@@ -0,0 +1,92 @@
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../include/algorithms/bfs_dfs/ConnectedComponents.h"
+#include "../include/algorithms/bfs_dfs/ParallelConnectedComponents.h"
+#include "../include/graph/AdjacencyListGraph.h"
+#include "../include/graph/UndirectedGraph.h"
+#include "graph_test_utils.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using graph_test::EdgePairs;
+using graph_test::makeSymmetricView;
+
+/**
+ * @brief Гигантская компонента из случайных рёбер и много мелких.
+ */
+EdgePairs giantAndSmall(uint32_t n, uint32_t giant, std::mt19937& rng) {
+  EdgePairs edges;
+  for (uint32_t i = 0; i < 2 * giant; ++i) {
+    edges.emplace_back(static_cast<uint32_t>(rng() % giant),
+                       static_cast<uint32_t>(rng() % giant));
+  }
+  for (uint32_t v = giant; v + 1 < n; v += 3) {
+    edges.emplace_back(v, v + 1);
+  }
+  return edges;
+}
+
+}  // namespace
+
+TEST(ParallelConnectedComponentsTest, UndirectedGraph) {
+  graph::UndirectedGraph<> graph;
+  for (int v = 1; v <= 6; ++v) {
+    graph.addVertex(graph::Vertex(v));
+  }
+  graph.addEdge(graph::Vertex(1), graph::Vertex(2));
+  graph.addEdge(graph::Vertex(3), graph::Vertex(2));
+  graph.addEdge(graph::Vertex(4), graph::Vertex(5));
+
+  graph::AdjacencyView<> view(graph);
+  for (size_t threads : {1, 4}) {
+    graph::ParallelConnectedComponents<> cc(view, threads);
+    EXPECT_EQ(cc.componentCount(), 3u);
+    EXPECT_EQ(cc.getComponents(),
+              graph::ConnectedComponents<>(view).getComponents());
+  }
+}
+
+TEST(ParallelConnectedComponentsTest, AdjacencyListGraphIsSymmetrized) {
+  graph::AdjacencyListGraph<> graph;
+  for (int v = 1; v <= 5; ++v) {
+    graph.addVertex(graph::Vertex(v));
+  }
+  // Рёбра только в одну сторону
+  graph.addEdge(graph::Vertex(5), graph::Vertex(1));
+  graph.addEdge(graph::Vertex(4), graph::Vertex(5));
+  graph.addEdge(graph::Vertex(2), graph::Vertex(3));
+
+  auto view = graph::AdjacencyView<>(graph).symmetrize();
+  graph::ParallelConnectedComponents<> cc(view, 4);
+  EXPECT_EQ(cc.componentCount(), 2u);
+  EXPECT_EQ(cc.getComponent(view.getIndex(graph::Vertex(1))),
+            cc.getComponent(view.getIndex(graph::Vertex(4))));
+}
+
+TEST(ParallelConnectedComponentsTest, MatchesSequentialOnRandomGraphs) {
+  std::mt19937 rng(48);
+  for (int trial = 0; trial < 30; ++trial) {
+    uint32_t n = 1 + static_cast<uint32_t>(rng() % 3000);
+    EdgePairs edges = giantAndSmall(n, 1 + n / 2, rng);
+    auto view = makeSymmetricView(n, edges);
+    auto expected = graph::ConnectedComponents<>(view).getComponents();
+    for (size_t threads : {1, 2, 8}) {
+      graph::ParallelConnectedComponents<> cc(view, threads);
+      ASSERT_EQ(cc.getComponents(), expected);
+    }
+  }
+}
+
+TEST(ParallelConnectedComponentsTest, LargeGraph) {
+  std::mt19937 rng(7);
+  const uint32_t n = 300000;
+  auto view = makeSymmetricView(n, giantAndSmall(n, n / 2, rng));
+  graph::ConnectedComponents<> sequential(view);
+  graph::ParallelConnectedComponents<> parallel(view, 8);
+  EXPECT_EQ(parallel.componentCount(), sequential.componentCount());
+  EXPECT_EQ(parallel.getComponents(), sequential.getComponents());
+}
@@ -0,0 +1,106 @@
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "../include/algorithms/flowNetwork/ParallelPushRelabel.h"
+#include "../include/algorithms/flowNetwork/PushRelabel.h"
+#include "../include/graph/DirectedGraph.h"
+#include "flow_test_utils.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using Network = graph::FlowNetwork<graph::DirectedGraph<>>;
+using ParallelSolver = graph::ParallelPushRelabelSolver<graph::DirectedGraph<>>;
+using flow_test::Arc;
+using flow_test::expectValidFlow;
+using flow_test::makeNetwork;
+using flow_test::randomArcs;
+using flow_test::sourceSide;
+
+}  // namespace
+
+TEST(ParallelPushRelabelTest, ClassicNetwork) {
+  std::vector<Arc> arcs = {{0, 1, 16}, {0, 2, 13}, {1, 2, 10}, {2, 1, 4},
+                           {1, 3, 12}, {3, 2, 9},  {2, 4, 14}, {4, 3, 7},
+                           {3, 5, 20}, {4, 5, 4}};
+  for (size_t threads : {1u, 2u, 4u}) {
+    Network network = makeNetwork(6, arcs);
+    ParallelSolver solver(network, threads);
+    EXPECT_EQ(solver.computeMaxFlow(graph::Vertex(0), graph::Vertex(5)), 23);
+    expectValidFlow(network, 0, 5, 23);
+  }
+}
+
+TEST(ParallelPushRelabelTest, UnreachableSinkAndStrandedExcess) {
+  Network network = makeNetwork(5, {{0, 1, 10}, {1, 2, 1}, {1, 3, 5}});
+  ParallelSolver solver(network, 4);
+  EXPECT_EQ(solver.computeMaxFlow(graph::Vertex(0), graph::Vertex(2)), 1);
+  expectValidFlow(network, 0, 2, 1);
+  EXPECT_EQ(solver.computeMaxFlow(graph::Vertex(0), graph::Vertex(4)), 0);
+  EXPECT_EQ(solver.computeMaxFlow(graph::Vertex(3), graph::Vertex(3)), 0);
+}
+
+TEST(ParallelPushRelabelTest, MatchesSequentialFlowAndMinCut) {
+  std::mt19937 rng(34);
+  for (int trial = 0; trial < 60; ++trial) {
+    int n = 2 + static_cast<int>(rng() % 200);
+    auto arcs = randomArcs(rng, n, 5 * n, 0, 49);
+    int s = static_cast<int>(rng() % n);
+    int t = static_cast<int>(rng() % n);
+    if (s == t) continue;
+
+    Network reference = makeNetwork(n, arcs);
+    graph::PushRelabelSolver<graph::DirectedGraph<>> sequential(reference);
+    int expected =
+        sequential.computeMaxFlow(graph::Vertex(s), graph::Vertex(t));
+    auto expectedCut = sourceSide(reference, s);
+
+    for (size_t threads : {1u, 3u, 8u}) {
+      Network network = makeNetwork(n, arcs);
+      ParallelSolver solver(network, threads);
+      EXPECT_EQ(solver.computeMaxFlow(graph::Vertex(s), graph::Vertex(t)),
+                expected);
+      expectValidFlow(network, s, t, expected);
+      EXPECT_EQ(sourceSide(network, s), expectedCut);
+    }
+  }
+}
+
+TEST(ParallelPushRelabelTest, LargeGridNetwork) {
+  // Решётка с источником слева и стоком справа
+  const int rows = 60;
+  const int columns = 60;
+  std::mt19937 rng(8);
+  std::vector<Arc> arcs;
+  auto id = [&](int r, int c) { return r * columns + c; };
+  int source = rows * columns;
+  int sink = source + 1;
+  for (int r = 0; r < rows; ++r) {
+    arcs.emplace_back(source, id(r, 0), 100);
+    arcs.emplace_back(id(r, columns - 1), sink, 100);
+    for (int c = 0; c < columns; ++c) {
+      if (c + 1 < columns) {
+        arcs.emplace_back(id(r, c), id(r, c + 1),
+                          1 + static_cast<int>(rng() % 20));
+      }
+      if (r + 1 < rows) {
+        arcs.emplace_back(id(r, c), id(r + 1, c),
+                          1 + static_cast<int>(rng() % 20));
+        arcs.emplace_back(id(r + 1, c), id(r, c),
+                          1 + static_cast<int>(rng() % 20));
+      }
+    }
+  }
+  Network reference = makeNetwork(sink + 1, arcs);
+  graph::PushRelabelSolver<graph::DirectedGraph<>> sequential(reference);
+  int expected =
+      sequential.computeMaxFlow(graph::Vertex(source), graph::Vertex(sink));
+
+  Network network = makeNetwork(sink + 1, arcs);
+  ParallelSolver solver(network, 4);
+  EXPECT_EQ(solver.computeMaxFlow(graph::Vertex(source), graph::Vertex(sink)),
+            expected);
+  expectValidFlow(network, source, sink, expected);
+  EXPECT_EQ(sourceSide(network, source), sourceSide(reference, source));
+}
@@ -0,0 +1,109 @@
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../include/algorithms/bfs_dfs/ParallelStronglyConnectedComponents.h"
+#include "../include/algorithms/bfs_dfs/StronglyConnectedComponents.h"
+#include "../include/graph/DirectedGraph.h"
+#include "graph_test_utils.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using graph_test::EdgePairs;
+using graph_test::makeView;
+
+/**
+ * @brief Номера компонент последовательного алгоритма, перенумерованные в
+ * порядке наименьшей вершины, как в параллельном.
+ */
+std::vector<uint32_t> sequentialLabels(const graph::AdjacencyView<>& view) {
+  graph::StronglyConnectedComponents<> scc(view);
+  std::vector<uint32_t> dense(scc.componentCount(), UINT32_MAX);
+  std::vector<uint32_t> labels(view.vertexCount());
+  uint32_t next = 0;
+  for (size_t v = 0; v < view.vertexCount(); ++v) {
+    uint32_t c = scc.getComponent(v);
+    if (dense[c] == UINT32_MAX) dense[c] = next++;
+    labels[v] = dense[c];
+  }
+  return labels;
+}
+
+/**
+ * @brief Случайный граф из нескольких циклов, связанных случайными рёбрами.
+ */
+EdgePairs plantedCycles(uint32_t n, uint32_t cycles, uint32_t extra,
+                        std::mt19937& rng) {
+  EdgePairs edges;
+  for (uint32_t v = 0; v < n; ++v) {
+    uint32_t c = v % cycles;
+    uint32_t next = v + cycles < n ? v + cycles : c;
+    if (rng() % 8 != 0) edges.emplace_back(v, next);
+  }
+  for (uint32_t i = 0; i < extra; ++i) {
+    edges.emplace_back(static_cast<uint32_t>(rng() % n),
+                       static_cast<uint32_t>(rng() % n));
+  }
+  return edges;
+}
+
+}  // namespace
+
+TEST(ParallelStronglyConnectedComponentsTest, DirectedGraph) {
+  graph::DirectedGraph<> graph;
+  for (int v = 1; v <= 7; ++v) {
+    graph.addVertex(graph::Vertex(v));
+  }
+  // Цикл 1-2-3, цикл 4-5 с петлёй на 5, висячие 6 и 7
+  graph.addEdge(graph::Vertex(6), graph::Vertex(1));
+  graph.addEdge(graph::Vertex(1), graph::Vertex(2));
+  graph.addEdge(graph::Vertex(2), graph::Vertex(3));
+  graph.addEdge(graph::Vertex(3), graph::Vertex(1));
+  graph.addEdge(graph::Vertex(3), graph::Vertex(4));
+  graph.addEdge(graph::Vertex(4), graph::Vertex(5));
+  graph.addEdge(graph::Vertex(5), graph::Vertex(4));
+  graph.addEdge(graph::Vertex(5), graph::Vertex(5));
+  graph.addEdge(graph::Vertex(5), graph::Vertex(7));
+
+  graph::AdjacencyView<> view(graph);
+  for (size_t threads : {1, 4}) {
+    graph::ParallelStronglyConnectedComponents<> scc(view, threads);
+    EXPECT_EQ(scc.componentCount(), 4u);
+    EXPECT_EQ(scc.getComponents(), sequentialLabels(view));
+  }
+}
+
+TEST(ParallelStronglyConnectedComponentsTest, RandomGraphsMatchSequential) {
+  std::mt19937 rng(45);
+  for (int trial = 0; trial < 150; ++trial) {
+    uint32_t n = 1 + static_cast<uint32_t>(rng() % 60);
+    EdgePairs edges;
+    if (trial % 2 == 0) {
+      for (uint32_t i = 0, m = static_cast<uint32_t>(rng() % (2 * n)); i < m;
+           ++i) {
+        edges.emplace_back(static_cast<uint32_t>(rng() % n),
+                           static_cast<uint32_t>(rng() % n));
+      }
+    } else {
+      edges = plantedCycles(n, 1 + static_cast<uint32_t>(rng() % 6), n / 4,
+                            rng);
+    }
+    graph::AdjacencyView<> view = makeView(n, edges);
+    std::vector<uint32_t> expected = sequentialLabels(view);
+    for (size_t threads : {1, 3}) {
+      graph::ParallelStronglyConnectedComponents<> scc(view, threads);
+      ASSERT_EQ(scc.getComponents(), expected) << "trial " << trial;
+    }
+  }
+}
+
+TEST(ParallelStronglyConnectedComponentsTest, LargeGraphMatchesSequential) {
+  std::mt19937 rng(46);
+  const uint32_t n = 200000;
+  EdgePairs edges = plantedCycles(n, 50, n / 20, rng);
+  graph::AdjacencyView<> view = makeView(n, edges);
+  graph::ParallelStronglyConnectedComponents<> scc(view, 4);
+  EXPECT_EQ(scc.getComponents(), sequentialLabels(view));
+}
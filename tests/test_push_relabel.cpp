@@ -0,0 +1,108 @@
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "../include/algorithms/flowNetwork/Dinic.h"
+#include "../include/algorithms/flowNetwork/PushRelabel.h"
+#include "../include/graph/DirectedGraph.h"
+#include "flow_test_utils.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using Network = graph::FlowNetwork<graph::DirectedGraph<>>;
+using Solver = graph::PushRelabelSolver<graph::DirectedGraph<>>;
+using flow_test::Arc;
+using flow_test::expectValidFlow;
+using flow_test::makeNetwork;
+using flow_test::randomArcs;
+
+const graph::PushRelabelRule kRules[] = {graph::PushRelabelRule::HighestLabel,
+                                         graph::PushRelabelRule::Fifo};
+
+}  // namespace
+
+TEST(PushRelabelTest, ClassicNetwork) {
+  std::vector<Arc> arcs = {{0, 1, 16}, {0, 2, 13}, {1, 2, 10}, {2, 1, 4},
+                           {1, 3, 12}, {3, 2, 9},  {2, 4, 14}, {4, 3, 7},
+                           {3, 5, 20}, {4, 5, 4}};
+  for (auto rule : kRules) {
+    Network network = makeNetwork(6, arcs);
+    Solver solver(network, rule);
+    EXPECT_EQ(solver.computeMaxFlow(graph::Vertex(0), graph::Vertex(5)), 23);
+    expectValidFlow(network, 0, 5, 23);
+  }
+}
+
+TEST(PushRelabelTest, ExcessReturnsToSource) {
+  // Исток может отдать 10, но до стока доходит только 1
+  std::vector<Arc> arcs = {{0, 1, 10}, {1, 2, 1}, {1, 3, 5}, {3, 4, 5}};
+  for (auto rule : kRules) {
+    Network network = makeNetwork(5, arcs);
+    Solver solver(network, rule);
+    EXPECT_EQ(solver.computeMaxFlow(graph::Vertex(0), graph::Vertex(2)), 1);
+    expectValidFlow(network, 0, 2, 1);
+  }
+}
+
+TEST(PushRelabelTest, UnreachableSinkAndSameVertex) {
+  Network network = makeNetwork(4, {{0, 1, 5}, {2, 3, 5}});
+  Solver solver(network);
+  EXPECT_EQ(solver.computeMaxFlow(graph::Vertex(0), graph::Vertex(3)), 0);
+  expectValidFlow(network, 0, 3, 0);
+  EXPECT_EQ(solver.computeMaxFlow(graph::Vertex(1), graph::Vertex(1)), 0);
+}
+
+TEST(PushRelabelTest, RandomNetworksMatchDinic) {
+  std::mt19937 rng(32);
+  for (int trial = 0; trial < 200; ++trial) {
+    int n = 2 + static_cast<int>(rng() % 40);
+    int m = static_cast<int>(rng() % (6 * n));
+    auto arcs = randomArcs(rng, n, m, 0, 19);
+    int s = static_cast<int>(rng() % n);
+    int t = static_cast<int>(rng() % n);
+    if (s == t) continue;
+
+    Network reference = makeNetwork(n, arcs);
+    graph::DinicSolver<graph::DirectedGraph<>> dinic(reference);
+    int expected = dinic.computeMaxFlow(graph::Vertex(s), graph::Vertex(t));
+
+    for (auto rule : kRules) {
+      Network network = makeNetwork(n, arcs);
+      Solver solver(network, rule);
+      EXPECT_EQ(solver.computeMaxFlow(graph::Vertex(s), graph::Vertex(t)),
+                expected);
+      expectValidFlow(network, s, t, expected);
+    }
+  }
+}
+
+TEST(PushRelabelTest, BipartiteAssignment) {
+  // Исток -> работники -> задачи -> сток, все ёмкости единичные
+  const int workers = 300;
+  const int tasks = 300;
+  std::mt19937 rng(5);
+  Network network;
+  int source = workers + tasks;
+  int sink = source + 1;
+  for (int w = 0; w < workers; ++w) {
+    network.addEdge(graph::Vertex(source), graph::Vertex(w), 1);
+    for (int k = 0; k < 5; ++k) {
+      network.addEdge(graph::Vertex(w),
+                      graph::Vertex(workers + static_cast<int>(rng() % tasks)),
+                      1);
+    }
+  }
+  for (int k = 0; k < tasks; ++k) {
+    network.addEdge(graph::Vertex(workers + k), graph::Vertex(sink), 1);
+  }
+  Network reference = network;
+
+  graph::DinicSolver<graph::DirectedGraph<>> dinic(reference);
+  int expected =
+      dinic.computeMaxFlow(graph::Vertex(source), graph::Vertex(sink));
+  Solver solver(network);
+  EXPECT_EQ(solver.computeMaxFlow(graph::Vertex(source), graph::Vertex(sink)),
+            expected);
+  expectValidFlow(network, source, sink, expected);
+}
@@ -0,0 +1,147 @@
+#include <cstdint>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "../include/algorithms/bfs_dfs/StronglyConnectedComponents.h"
+#include "../include/graph/DirectedGraph.h"
+#include "graph_test_utils.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using graph_test::EdgePairs;
+using graph_test::makeView;
+
+/**
+ * @brief Матрица достижимости, построенная обходами из каждой вершины.
+ */
+std::vector<std::vector<char>> reachability(
+    const graph::AdjacencyView<>& view) {
+  const size_t n = view.vertexCount();
+  std::vector<std::vector<char>> reach(n, std::vector<char>(n, 0));
+  for (size_t s = 0; s < n; ++s) {
+    std::vector<size_t> queue = {s};
+    reach[s][s] = 1;
+    for (size_t head = 0; head < queue.size(); ++head) {
+      size_t u = queue[head];
+      for (size_t i = view.begin(u); i < view.end(u); ++i) {
+        size_t v = view.neighbor(i);
+        if (!reach[s][v]) {
+          reach[s][v] = 1;
+          queue.push_back(v);
+        }
+      }
+    }
+  }
+  return reach;
+}
+
+}  // namespace
+
+TEST(StronglyConnectedComponentsTest, DirectedGraphComponents) {
+  graph::DirectedGraph<> graph;
+  for (int v = 1; v <= 6; ++v) {
+    graph.addVertex(graph::Vertex(v));
+  }
+  graph.addEdge(graph::Vertex(1), graph::Vertex(2));
+  graph.addEdge(graph::Vertex(2), graph::Vertex(3));
+  graph.addEdge(graph::Vertex(3), graph::Vertex(1));
+  graph.addEdge(graph::Vertex(3), graph::Vertex(4));
+  graph.addEdge(graph::Vertex(2), graph::Vertex(5));
+  graph.addEdge(graph::Vertex(4), graph::Vertex(5));
+  graph.addEdge(graph::Vertex(5), graph::Vertex(4));
+
+  graph::AdjacencyView<> view(graph);
+  graph::StronglyConnectedComponents<> scc(view);
+  ASSERT_EQ(scc.componentCount(), 3u);
+  EXPECT_TRUE(scc.hasCycle());
+
+  uint32_t a = scc.getComponent(view.getIndex(graph::Vertex(1)));
+  uint32_t b = scc.getComponent(view.getIndex(graph::Vertex(4)));
+  EXPECT_EQ(scc.getComponent(view.getIndex(graph::Vertex(3))), a);
+  EXPECT_EQ(scc.getComponent(view.getIndex(graph::Vertex(5))), b);
+  EXPECT_LT(a, b);
+  EXPECT_EQ(scc.getComponentSize(a), 3u);
+
+  std::set<int> members;
+  for (const auto& v : scc.getComponentVertices(b)) {
+    members.insert(v.id);
+  }
+  EXPECT_EQ(members, (std::set<int>{4, 5}));
+
+  // Два ребра из {1, 2, 3} в {4, 5} сливаются в одно
+  auto dag = scc.getCondensation();
+  EXPECT_EQ(dag.vertexCount(), 3u);
+  ASSERT_EQ(dag.edgeCount(), 1u);
+  EXPECT_EQ(dag.degree(a), 1u);
+  EXPECT_EQ(dag.neighbor(dag.begin(a)), b);
+}
+
+TEST(StronglyConnectedComponentsTest, AcyclicGraphAndSelfLoop) {
+  graph::AdjacencyView<> dag = makeView(4, {{0, 1}, {1, 2}, {0, 3}, {3, 2}});
+  graph::StronglyConnectedComponents<> scc(dag);
+  EXPECT_EQ(scc.componentCount(), 4u);
+  EXPECT_FALSE(scc.hasCycle());
+  // Номера компонент — топологический порядок
+  for (size_t u = 0; u < dag.vertexCount(); ++u) {
+    for (size_t i = dag.begin(u); i < dag.end(u); ++i) {
+      EXPECT_LT(scc.getComponent(u), scc.getComponent(dag.neighbor(i)));
+    }
+  }
+
+  graph::AdjacencyView<> loop = makeView(2, {{0, 1}, {1, 1}});
+  graph::StronglyConnectedComponents<> withLoop(loop);
+  EXPECT_EQ(withLoop.componentCount(), 2u);
+  EXPECT_TRUE(withLoop.hasCycle());
+  EXPECT_EQ(withLoop.getCondensation().edgeCount(), 1u);
+}
+
+TEST(StronglyConnectedComponentsTest, RandomGraphsMatchReachability) {
+  std::mt19937 rng(44);
+  for (int trial = 0; trial < 100; ++trial) {
+    uint32_t n = 1 + static_cast<uint32_t>(rng() % 40);
+    EdgePairs edges;
+    for (uint32_t i = 0, m = static_cast<uint32_t>(rng() % (3 * n)); i < m;
+         ++i) {
+      edges.emplace_back(static_cast<uint32_t>(rng() % n),
+                         static_cast<uint32_t>(rng() % n));
+    }
+    graph::AdjacencyView<> view = makeView(n, edges);
+    graph::StronglyConnectedComponents<> scc(view);
+    auto reach = reachability(view);
+
+    for (uint32_t u = 0; u < n; ++u) {
+      for (uint32_t v = 0; v < n; ++v) {
+        bool same = reach[u][v] && reach[v][u];
+        ASSERT_EQ(scc.getComponent(u) == scc.getComponent(v), same);
+      }
+    }
+    auto dag = scc.getCondensation();
+    for (size_t c = 0; c < dag.vertexCount(); ++c) {
+      std::set<uint32_t> targets;
+      for (size_t i = dag.begin(c); i < dag.end(c); ++i) {
+        ASSERT_LT(c, dag.neighbor(i));
+        ASSERT_TRUE(targets.insert(dag.neighbor(i)).second);
+      }
+    }
+  }
+}
+
+TEST(StronglyConnectedComponentsTest, MillionVertexCycle) {
+  const uint32_t n = 1000000;
+  EdgePairs edges;
+  for (uint32_t v = 0; v < n; ++v) {
+    edges.emplace_back(v, (v + 1) % n);
+  }
+  graph::AdjacencyView<> cycle = makeView(n, edges);
+  EXPECT_EQ(graph::StronglyConnectedComponents<>(cycle).componentCount(), 1u);
+
+  edges.pop_back();
+  graph::AdjacencyView<> chain = makeView(n, edges);
+  graph::StronglyConnectedComponents<> scc(chain);
+  EXPECT_EQ(scc.componentCount(), n);
+  EXPECT_EQ(scc.getComponent(0), 0u);
+  EXPECT_EQ(scc.getComponent(n - 1), n - 1);
+}
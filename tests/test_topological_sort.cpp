@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../include/algorithms/bfs_dfs/ParallelTopologicalSort.h"
+#include "../include/algorithms/bfs_dfs/TopologicalSort.h"
+#include "../include/graph/DirectedGraph.h"
+#include "graph_test_utils.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using graph_test::EdgePairs;
+using graph_test::makeView;
+
+/**
+ * @brief Случайный ациклический граф: рёбра идут вперёд по перестановке.
+ */
+EdgePairs randomDag(uint32_t n, uint32_t m, std::mt19937& rng) {
+  std::vector<uint32_t> rank(n);
+  std::iota(rank.begin(), rank.end(), 0);
+  std::shuffle(rank.begin(), rank.end(), rng);
+  EdgePairs edges;
+  for (uint32_t i = 0; i < m && n > 1; ++i) {
+    uint32_t a = static_cast<uint32_t>(rng() % n);
+    uint32_t b = static_cast<uint32_t>(rng() % n);
+    if (a == b) continue;
+    if (a > b) std::swap(a, b);
+    edges.emplace_back(rank[a], rank[b]);
+  }
+  return edges;
+}
+
+/**
+ * @brief Проверяет, что порядок содержит все вершины и все рёбра ведут
+ * вперёд.
+ */
+void expectTopological(const graph::AdjacencyView<>& view,
+                       const std::vector<uint32_t>& order) {
+  ASSERT_EQ(order.size(), view.vertexCount());
+  std::vector<size_t> position(view.vertexCount(), SIZE_MAX);
+  for (size_t i = 0; i < order.size(); ++i) {
+    ASSERT_EQ(position[order[i]], SIZE_MAX);
+    position[order[i]] = i;
+  }
+  for (size_t u = 0; u < view.vertexCount(); ++u) {
+    for (size_t i = view.begin(u); i < view.end(u); ++i) {
+      ASSERT_LT(position[u], position[view.neighbor(i)]);
+    }
+  }
+}
+
+}  // namespace
+
+TEST(TopologicalSortTest, DirectedGraph) {
+  graph::DirectedGraph<> graph;
+  for (int v = 1; v <= 5; ++v) {
+    graph.addVertex(graph::Vertex(v));
+  }
+  graph.addEdge(graph::Vertex(5), graph::Vertex(3));
+  graph.addEdge(graph::Vertex(3), graph::Vertex(1));
+  graph.addEdge(graph::Vertex(5), graph::Vertex(4));
+  graph.addEdge(graph::Vertex(4), graph::Vertex(1));
+  graph.addEdge(graph::Vertex(1), graph::Vertex(2));
+
+  auto order = graph::topologicalSort(graph);
+  ASSERT_EQ(order.size(), 5u);
+  EXPECT_EQ(order.front(), graph::Vertex(5));
+  EXPECT_EQ(order.back(), graph::Vertex(2));
+
+  graph.addEdge(graph::Vertex(2), graph::Vertex(5));
+  EXPECT_THROW(graph::topologicalSort(graph), std::invalid_argument);
+}
+
+TEST(TopologicalSortTest, ReportsCycle) {
+  // 0 -> 1 -> 2 -> 3 -> 1, из цикла достижима 4
+  auto view = makeView(5, {{0, 1}, {1, 2}, {2, 3}, {3, 1}, {3, 4}});
+  graph::TopologicalSort<> sort(view);
+  EXPECT_FALSE(sort.isAcyclic());
+  EXPECT_EQ(sort.getOrder(), (std::vector<uint32_t>{0}));
+  EXPECT_EQ(sort.getCyclicVertices(), (std::vector<uint32_t>{1, 2, 3, 4}));
+
+  auto cycle = sort.findCycle();
+  ASSERT_EQ(cycle.size(), 3u);
+  auto first = std::min_element(cycle.begin(), cycle.end());
+  std::rotate(cycle.begin(), first, cycle.end());
+  EXPECT_EQ(cycle, (std::vector<uint32_t>{1, 2, 3}));
+}
+
+TEST(TopologicalSortTest, RandomGraphs) {
+  std::mt19937 rng(50);
+  for (int trial = 0; trial < 100; ++trial) {
+    uint32_t n = 1 + static_cast<uint32_t>(rng() % 60);
+    EdgePairs edges = randomDag(n, 3 * n, rng);
+    const bool cyclic = trial % 2 == 1 && n > 1;
+    if (cyclic) {
+      // Пара встречных рёбер замыкает цикл
+      uint32_t a = static_cast<uint32_t>(rng() % n);
+      uint32_t b = static_cast<uint32_t>(rng() % n);
+      edges.emplace_back(a, b);
+      edges.emplace_back(b, a);
+    }
+    auto view = makeView(n, edges);
+    graph::TopologicalSort<> sort(view);
+    graph::ParallelTopologicalSort<> levels(view, 4);
+    ASSERT_EQ(levels.isAcyclic(), sort.isAcyclic());
+    if (!sort.isAcyclic()) {
+      auto cycle = sort.findCycle();
+      ASSERT_FALSE(cycle.empty());
+      for (size_t i = 0; i < cycle.size(); ++i) {
+        uint32_t u = cycle[i];
+        uint32_t w = cycle[(i + 1) % cycle.size()];
+        bool found = false;
+        for (size_t j = view.begin(u); j < view.end(u); ++j) {
+          found = found || view.neighbor(j) == w;
+        }
+        ASSERT_TRUE(found);
+      }
+      continue;
+    }
+    expectTopological(view, sort.getOrder());
+    expectTopological(view, levels.getOrder());
+  }
+}
+
+TEST(ParallelTopologicalSortTest, LevelsAreLongestPathDepths) {
+  std::mt19937 rng(51);
+  const uint32_t n = 20000;
+  auto view = makeView(n, randomDag(n, 4 * n, rng));
+  graph::TopologicalSort<> sort(view);
+  ASSERT_TRUE(sort.isAcyclic());
+
+  // Уровень вершины — число вершин на самом длинном пути в неё минус один
+  std::vector<uint32_t> depth(n, 0);
+  for (uint32_t u : sort.getOrder()) {
+    for (size_t i = view.begin(u); i < view.end(u); ++i) {
+      uint32_t w = view.neighbor(i);
+      depth[w] = std::max(depth[w], depth[u] + 1);
+    }
+  }
+
+  graph::ParallelTopologicalSort<> single(view, 1);
+  for (size_t threads : {2, 8}) {
+    graph::ParallelTopologicalSort<> levels(view, threads);
+    ASSERT_EQ(levels.getOrder(), single.getOrder());
+    for (uint32_t v = 0; v < n; ++v) {
+      ASSERT_EQ(levels.getLevel(v), depth[v]);
+    }
+    for (size_t k = 0; k < levels.levelCount(); ++k) {
+      for (size_t i = levels.levelBegin(k); i < levels.levelEnd(k); ++i) {
+        ASSERT_EQ(levels.getLevel(levels.getOrder()[i]), k);
+      }
+    }
+  }
+}
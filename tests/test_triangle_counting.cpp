@@ -0,0 +1,95 @@
+#include "../include/algorithms/clustering/TriangleCounting.h"
+#include "../include/graph/AdjacencyMatrixGraph.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+void addUndirectedEdge(graph::AdjacencyMatrixGraph<graph::Vertex, graph::Edge>& g,
+                       int u, int v) {
+  g.addEdge(graph::Vertex(u), graph::Vertex(v));
+  g.addEdge(graph::Vertex(v), graph::Vertex(u));
+}
+
+}  // namespace
+
+TEST(TriangleCountingTest, EmptyGraph) {
+  graph::AdjacencyMatrixGraph<graph::Vertex, graph::Edge> graph;
+  auto result = graph::countTriangles(graph);
+  EXPECT_EQ(result.totalTriangles, 0u);
+  EXPECT_TRUE(result.triangles.empty());
+}
+
+TEST(TriangleCountingTest, SingleTriangle) {
+  graph::AdjacencyMatrixGraph<graph::Vertex, graph::Edge> graph;
+  for (int i = 1; i <= 3; ++i) graph.addVertex(graph::Vertex(i));
+  addUndirectedEdge(graph, 1, 2);
+  addUndirectedEdge(graph, 2, 3);
+  addUndirectedEdge(graph, 1, 3);
+
+  auto result = graph::countTriangles(graph);
+  EXPECT_EQ(result.totalTriangles, 1u);
+  for (size_t i = 0; i < 3; ++i) {
+    EXPECT_EQ(result.triangles[i], 1u);
+    EXPECT_DOUBLE_EQ(result.localClustering[i], 1.0);
+  }
+  EXPECT_DOUBLE_EQ(result.globalClustering, 1.0);
+  EXPECT_DOUBLE_EQ(result.averageClustering, 1.0);
+}
+
+TEST(TriangleCountingTest, DirectedEdgesAreSymmetrized) {
+  graph::AdjacencyMatrixGraph<graph::Vertex, graph::Edge> graph;
+  for (int i = 1; i <= 4; ++i) graph.addVertex(graph::Vertex(i));
+  graph.addEdge(graph::Vertex(1), graph::Vertex(2));
+  graph.addEdge(graph::Vertex(2), graph::Vertex(3));
+  graph.addEdge(graph::Vertex(3), graph::Vertex(1));
+  graph.addEdge(graph::Vertex(3), graph::Vertex(4));
+  graph.addEdge(graph::Vertex(4), graph::Vertex(4));
+
+  auto result = graph::countTriangles(graph);
+  EXPECT_EQ(result.totalTriangles, 1u);
+  EXPECT_EQ(result.vertices[2], graph::Vertex(3));
+  EXPECT_EQ(result.triangles[2], 1u);
+  EXPECT_EQ(result.triangles[3], 0u);
+  // У вершины 3 три соседа и одна пара из них смежна.
+  EXPECT_DOUBLE_EQ(result.localClustering[2], 1.0 / 3.0);
+  EXPECT_DOUBLE_EQ(result.localClustering[3], 0.0);
+  // Три треугольных тройки из пяти связных троек.
+  EXPECT_DOUBLE_EQ(result.globalClustering, 3.0 / 5.0);
+}
+
+TEST(TriangleCountingTest, CompleteGraphAcrossWordBoundary) {
+  graph::AdjacencyMatrixGraph<graph::Vertex, graph::Edge> graph;
+  const int n = 70;
+  for (int i = 0; i < n; ++i) graph.addVertex(graph::Vertex(i));
+  for (int i = 0; i < n; ++i) {
+    for (int j = i + 1; j < n; ++j) {
+      addUndirectedEdge(graph, i, j);
+    }
+  }
+
+  auto sequential = graph::countTriangles(graph, 1);
+  auto parallel = graph::countTriangles(graph, 4);
+  const size_t expected = n * (n - 1) * (n - 2) / 6;
+  EXPECT_EQ(sequential.totalTriangles, expected);
+  EXPECT_EQ(parallel.totalTriangles, expected);
+  EXPECT_EQ(sequential.triangles, parallel.triangles);
+  EXPECT_EQ(parallel.triangles[n - 1], size_t((n - 1) * (n - 2) / 2));
+  EXPECT_DOUBLE_EQ(parallel.globalClustering, 1.0);
+}
+
+TEST(TriangleCountingTest, AfterVertexRemoval) {
+  graph::AdjacencyMatrixGraph<graph::Vertex, graph::Edge> graph;
+  for (int i = 1; i <= 4; ++i) graph.addVertex(graph::Vertex(i));
+  addUndirectedEdge(graph, 1, 2);
+  addUndirectedEdge(graph, 2, 3);
+  addUndirectedEdge(graph, 3, 4);
+  addUndirectedEdge(graph, 2, 4);
+  addUndirectedEdge(graph, 1, 3);
+
+  graph.removeVertex(graph::Vertex(1));
+  auto result = graph::countTriangles(graph);
+  EXPECT_EQ(result.totalTriangles, 1u);
+  EXPECT_EQ(result.vertices.size(), 3u);
+  EXPECT_TRUE(graph.hasEdge(graph::Vertex(2), graph::Vertex(4)));
+  EXPECT_FALSE(graph.hasVertex(graph::Vertex(1)));
+}
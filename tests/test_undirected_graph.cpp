@@ -1,3 +1,10 @@
+#include <atomic>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../include/algorithms/bfs_dfs/ConnectedComponents.h"
 #include "../include/graph/UndirectedGraph.h"
 #include "gtest/gtest.h"
 
@@ -120,3 +127,115 @@ TEST(UndirectedGraphTest, LargeGraph) {
   EXPECT_TRUE(graph.hasEdge(graph::Vertex(99), graph::Vertex(98)));
   EXPECT_FALSE(graph.hasEdge(graph::Vertex(0), graph::Vertex(99)));
 }
+
+TEST(UndirectedGraphTest, ConnectivityFollowsInsertions) {
+  graph::UndirectedGraph<> graph(true);
+  for (int v = 1; v <= 5; ++v) {
+    graph.addVertex(graph::Vertex(v));
+  }
+  EXPECT_EQ(graph.componentCount(), 5u);
+  graph.addEdge(graph::Vertex(1), graph::Vertex(2));
+  graph.addEdge(graph::Vertex(3), graph::Vertex(4));
+  EXPECT_EQ(graph.componentCount(), 3u);
+  EXPECT_TRUE(graph.connected(graph::Vertex(2), graph::Vertex(1)));
+  EXPECT_FALSE(graph.connected(graph::Vertex(1), graph::Vertex(3)));
+
+  graph.addEdge(graph::Vertex(2), graph::Vertex(3));
+  graph.addVertex(graph::Vertex(6));
+  EXPECT_TRUE(graph.connected(graph::Vertex(1), graph::Vertex(4)));
+  EXPECT_EQ(graph.componentCount(), 3u);
+  EXPECT_THROW(graph.connected(graph::Vertex(1), graph::Vertex(7)),
+               std::out_of_range);
+}
+
+TEST(UndirectedGraphTest, ConnectivityRebuildsAfterDeletion) {
+  graph::UndirectedGraph<> graph(true);
+  for (int v = 1; v <= 4; ++v) {
+    graph.addVertex(graph::Vertex(v));
+  }
+  graph.addEdge(graph::Vertex(1), graph::Vertex(2));
+  graph.addEdge(graph::Vertex(2), graph::Vertex(3));
+  graph.addEdge(graph::Vertex(3), graph::Vertex(4));
+  EXPECT_EQ(graph.componentCount(), 1u);
+
+  graph.removeEdge(graph::Vertex(3), graph::Vertex(2));
+  EXPECT_FALSE(graph.connected(graph::Vertex(1), graph::Vertex(4)));
+  EXPECT_EQ(graph.componentCount(), 2u);
+
+  graph.removeVertex(graph::Vertex(4));
+  graph.addEdge(graph::Vertex(1), graph::Vertex(3));
+  EXPECT_EQ(graph.componentCount(), 1u);
+}
+
+TEST(UndirectedGraphTest, ConnectivityIsOptional) {
+  graph::UndirectedGraph<> graph;
+  graph.addVertex(graph::Vertex(1));
+  graph.addVertex(graph::Vertex(2));
+  graph.addEdge(graph::Vertex(1), graph::Vertex(2));
+  EXPECT_FALSE(graph.tracksConnectivity());
+  EXPECT_THROW(graph.componentCount(), std::logic_error);
+
+  // Включение строит компоненты по уже добавленным рёбрам
+  graph.setConnectivityTracking(true);
+  EXPECT_TRUE(graph.connected(graph::Vertex(1), graph::Vertex(2)));
+  graph.setConnectivityTracking(false);
+  EXPECT_THROW(graph.connected(graph::Vertex(1), graph::Vertex(2)),
+               std::logic_error);
+}
+
+TEST(UndirectedGraphTest, ConnectivityMatchesComponentsUnderUpdates) {
+  std::mt19937 rng(49);
+  graph::UndirectedGraph<> graph(true);
+  const int n = 40;
+  for (int v = 0; v < n; ++v) {
+    graph.addVertex(graph::Vertex(v));
+  }
+  for (int step = 0; step < 400; ++step) {
+    graph::Vertex a(static_cast<int>(rng() % n));
+    graph::Vertex b(static_cast<int>(rng() % n));
+    if (rng() % 5 == 0) {
+      graph.removeEdge(a, b);
+    } else {
+      graph.addEdge(a, b);
+    }
+    graph::AdjacencyView<> view(graph);
+    graph::ConnectedComponents<> expected(view);
+    ASSERT_EQ(graph.componentCount(), expected.componentCount());
+    ASSERT_EQ(graph.connected(a, b),
+              expected.getComponent(view.getIndex(a)) ==
+                  expected.getComponent(view.getIndex(b)));
+  }
+}
+
+TEST(UndirectedGraphTest, ConcurrentConnectivityQueries) {
+  graph::UndirectedGraph<> graph(true);
+  const int n = 200;
+  for (int v = 0; v < n; ++v) {
+    graph.addVertex(graph::Vertex(v));
+  }
+  // Две цепочки: чётные и нечётные вершины
+  for (int v = 2; v < n; ++v) {
+    graph.addEdge(graph::Vertex(v - 2), graph::Vertex(v));
+  }
+  graph.removeEdge(graph::Vertex(0), graph::Vertex(2));
+  graph.addEdge(graph::Vertex(0), graph::Vertex(2));
+
+  const auto& queries = graph;
+  std::atomic<int> mismatches{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&, t] {
+      for (int v = t; v < n; ++v) {
+        bool expected = v % 2 == t % 2;
+        if (queries.connected(graph::Vertex(t), graph::Vertex(v)) != expected ||
+            queries.componentCount() != 2) {
+          ++mismatches;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(mismatches.load(), 0);
+}